@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace uniza_fri {
+
+	/**
+		Allocator for std::vector which places the first element on an address
+		aligned to Alignment bytes (typically size of the cache line).
+		Memory is over-allocated and the original pointer is stored right before the aligned block.
+	*/
+	template<typename T, size_t Alignment = 64>
+	class AlignedAllocator
+	{
+	public:
+
+		typedef T value_type;
+
+		template<typename U>
+		struct rebind
+		{
+			typedef AlignedAllocator<U, Alignment> other;
+		};
+
+		AlignedAllocator() = default;
+
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Alignment> & other);
+
+		T * allocate(size_t n);
+		void deallocate(T * p, size_t n);
+
+	};
+
+	template<typename T, size_t Alignment>
+	template<typename U>
+	AlignedAllocator<T, Alignment>::AlignedAllocator(const AlignedAllocator<U, Alignment> &)
+	{
+	}
+
+	template<typename T, size_t Alignment>
+	T * AlignedAllocator<T, Alignment>::allocate(size_t n)
+	{
+		void * raw = ::operator new(n * sizeof(T) + Alignment + sizeof(void*));
+		const uintptr_t first = reinterpret_cast<uintptr_t>(raw) + sizeof(void*);
+		const uintptr_t aligned = (first + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1);
+		reinterpret_cast<void**>(aligned)[-1] = raw;
+		return reinterpret_cast<T*>(aligned);
+	}
+
+	template<typename T, size_t Alignment>
+	void AlignedAllocator<T, Alignment>::deallocate(T * p, size_t)
+	{
+		::operator delete(reinterpret_cast<void**>(p)[-1]);
+	}
+
+	template<typename T, typename U, size_t Alignment>
+	bool operator==(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+	{
+		return true;
+	}
+
+	template<typename T, typename U, size_t Alignment>
+	bool operator!=(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+	{
+		return false;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include <fstream>
+#include <sstream>
+
+#include "AutoQueue.h"
+
+namespace uniza_fri {
+
+	const char * const AutoQueue::ProfilePath = "results/auto_queue_profile.csv";
+
+	const char * AutoQueue::getName(const int candidate)
+	{
+		static const char * const names[CandidateCount] = {
+			"BinaryHeap",
+			"DaryHeap4",
+			"PairingHeap",
+			"HybridQueue256",
+			"IntrusiveBinaryHeap",
+			"LazyStlBinaryHeap"
+		};
+
+		return names[candidate];
+	}
+
+	int AutoQueue::loadWinner(const std::string & graphName, const size_t vertexCount)
+	{
+		std::ifstream ifstr(ProfilePath);
+		std::string line;
+		int winner = NotCalibrated;
+
+		// neskorie riadky prepisuj skorie, po novej kalibrcii plat posledn
+		while (std::getline(ifstr, line))
+		{
+			std::istringstream lineStream(line);
+			std::string name;
+			std::string count;
+			std::string queueName;
+
+			if (!std::getline(lineStream, name, ';')
+			 || !std::getline(lineStream, count, ';')
+			 || !std::getline(lineStream, queueName)) continue;
+
+			if (name != graphName || count != std::to_string(vertexCount)) continue;
+
+			for (int i = 0; i < CandidateCount; i++)
+			{
+				if (queueName == getName(i))
+				{
+					winner = i;
+				}
+			}
+		}
+
+		return winner;
+	}
+
+	void AutoQueue::storeWinner(const std::string & graphName, const size_t vertexCount, const int candidate)
+	{
+		std::ofstream ofstr(ProfilePath, std::ios::app);
+		ofstr << graphName << ";" << vertexCount << ";" << getName(candidate) << std::endl;
+	}
+
+}
\ No newline at end of file
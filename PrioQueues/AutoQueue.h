@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string>
+
+#include "PrioQueueFactory.h"
+
+namespace uniza_fri {
+
+	/*
+		Fronty, spomedzi ktorch vyber auto_queue, a profil s vazmi ich kalibrcie.
+		Profil je textov sbor, na kadom riadku je nzov grafu, poet jeho vrcholov
+		a nzov vaznho frontu oddelen bodkoiarkou. Kalibrciu rob Dijkstra
+		pri prvom hadan s auto_queue nad grafom, ktor v profile ete nie je.
+	 */
+	class AutoQueue
+	{
+	public:
+
+		static const int CandidateCount = 6;
+		static const int CalibrationQueries = 5;
+		static const int NotCalibrated = -1;
+		static const char * const ProfilePath;
+
+		/*
+			Zavol f so znakou (intanciou przdnej triedy) frontu s danm indexom.
+			Jedin switch na cel hadanie, samotn hadanie u be nad konkrtnym typom frontu.
+		 */
+		template<typename F>
+		static auto dispatch(int candidate, F && f) -> decltype(f(binary_heap()));
+
+		static const char * getName(int candidate);
+
+		/*
+			@return Index vaza pre dan graf alebo NotCalibrated, ak graf v profile nie je.
+		 */
+		static int loadWinner(const std::string & graphName, size_t vertexCount);
+		static void storeWinner(const std::string & graphName, size_t vertexCount, int candidate);
+
+	};
+
+	template<typename F>
+	auto AutoQueue::dispatch(const int candidate, F && f) -> decltype(f(binary_heap()))
+	{
+		switch (candidate)
+		{
+		case 0:  return f(binary_heap());
+		case 1:  return f(dary_heap<4>());
+		case 2:  return f(pairing_heap());
+		case 3:  return f(hybrid_queue<256>());
+		case 4:  return f(intrusive_binary_heap());
+		default: return f(lazy_stl_binary_heap());
+		}
+	}
+
+}
\ No newline at end of file
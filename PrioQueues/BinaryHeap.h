@@ -3,11 +3,12 @@
 #include <vector>
 
 #include "PriorityQueue.h"
+#include "BitOps.h"
 
 namespace uniza_fri {
 
-	template<typename N, typename E>
-	class BinaryHeap : public PriorityQueue<N, E>
+	template<typename N, typename E, typename Order = MinOrder<N>>
+	class BinaryHeap final : public PriorityQueue<N, E>
 	{
 	private:
 
@@ -19,22 +20,32 @@ namespace uniza_fri {
 
 	public:
 
+		typedef BinaryHeapItem entry_t;
+
 		explicit BinaryHeap(size_t initCapacity = 4);
 		virtual ~BinaryHeap();
 
 		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
 		void decreaseKey(QueueEntry<N, E> & entry, N prio)      override;
+		void decreaseKey(entry_t & entry, N prio);
 		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
 		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
 		E & findMin()                                           override;
 		size_t size()                                           override;
 		void clear()                                            override;
+		void reserve(size_t n)                                  override;
 
 	private:
 
 		void ensureCapacity();
 		void bubleUp(size_t index);
 		void bubleDown(size_t index);
+		void heapify();
+		void restoreHeap(size_t firstNew);
 
 	private:
 
@@ -44,8 +55,8 @@ namespace uniza_fri {
 
 			size_t index;
 
-			BinaryHeapItem(const E & pData, N pPrio, size_t pindex);
-			virtual ~BinaryHeapItem() = default;
+			BinaryHeapItem(E pData, N pPrio, size_t pindex);
+			~BinaryHeapItem() = default;
 			void setPrio(N newPrio);
 
 		};
@@ -55,15 +66,15 @@ namespace uniza_fri {
 	//
 	// BinaryHeapItem
 	//
-	template<typename N, typename E>
-	BinaryHeap<N, E>::BinaryHeapItem::BinaryHeapItem(const E & pData, N pPrio, size_t pindex) :
-		QueueEntry<N, E>(pData, pPrio),
+	template<typename N, typename E, typename Order>
+	BinaryHeap<N, E, Order>::BinaryHeapItem::BinaryHeapItem(E pData, N pPrio, size_t pindex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
 		index(pindex)
 	{
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::BinaryHeapItem::setPrio(N newPrio)
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::BinaryHeapItem::setPrio(N newPrio)
 	{
 		QueueEntry<N, E>::setPrioInternal(newPrio);
 	}
@@ -71,15 +82,15 @@ namespace uniza_fri {
 	//
 	// BinaryHeap
 	//
-	template<typename N, typename E>
-	BinaryHeap<N, E>::BinaryHeap(size_t initCapacity)
+	template<typename N, typename E, typename Order>
+	BinaryHeap<N, E, Order>::BinaryHeap(size_t initCapacity)
 	{
 		initCapacity = std::max<size_t>(4, initCapacity);
 		this->data.reserve(initCapacity);
 	}
 
-	template<typename N, typename E>
-	BinaryHeap<N, E>::~BinaryHeap()
+	template<typename N, typename E, typename Order>
+	BinaryHeap<N, E, Order>::~BinaryHeap()
 	{
 		for (BinaryHeapItem * item : this->data)
 		{
@@ -87,20 +98,44 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	QueueEntry<N, E> * BinaryHeap<N, E>::insert(const E & data, N prio)
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E> * BinaryHeap<N, E, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E> * BinaryHeap<N, E, Order>::insert(E && data, N prio)
 	{
 		this->ensureCapacity();
 
-		auto * newItem = new BinaryHeapItem(data, prio, this->data.size());
+		auto * newItem = new BinaryHeapItem(std::move(data), prio, this->data.size());
 		this->data.push_back(newItem);
 		this->bubleUp(this->data.size() - 1);
 
 		return newItem;
 	}
 
-	template<typename N, typename E>
-	E BinaryHeap<N, E>::deleteMin()
+	template<typename N, typename E, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt BinaryHeap<N, E, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		const size_t oldSize = this->data.size();
+
+		for (; first != last; ++first)
+		{
+			auto * newItem = new BinaryHeapItem(first->first, first->second, this->data.size());
+			this->data.push_back(newItem);
+			*out++ = newItem;
+		}
+
+		this->restoreHeap(oldSize);
+
+		return out;
+	}
+
+	template<typename N, typename E, typename Order>
+	std::pair<E, N> BinaryHeap<N, E, Order>::popMin()
 	{
 		if (this->isEmpty())
 		{
@@ -111,7 +146,7 @@ namespace uniza_fri {
 		BinaryHeapItem * last  = this->data.back();
 		this->data.pop_back();
 
-		E popedData = poped->getData();
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
 		delete poped;
 		
 		if (!this->data.empty())
@@ -124,8 +159,14 @@ namespace uniza_fri {
 		return popedData;
 	}
 
-	template<typename N, typename E>
-	E & BinaryHeap<N, E>::findMin()
+	template<typename N, typename E, typename Order>
+	E BinaryHeap<N, E, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Order>
+	E & BinaryHeap<N, E, Order>::findMin()
 	{
 		if (this->isEmpty())
 		{
@@ -137,45 +178,54 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	size_t BinaryHeap<N, E>::size()
+	template<typename N, typename E, typename Order>
+	size_t BinaryHeap<N, E, Order>::size()
 	{
 		return this->data.size();
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::decreaseKey(QueueEntry<N, E> & entry, N prio)
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::decreaseKey(QueueEntry<N, E> & entry, N prio)
 	{
-		PriorityQueue<N, E>::decKeyLogicCheck(entry, prio);
+		this->decreaseKey(static_cast<entry_t&>(entry), prio);
+	}
+
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::decreaseKey(entry_t & item, N prio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(item, prio);
 
-		auto & item = dynamic_cast<BinaryHeapItem&>(entry);
 		item.setPrio(prio);
 		this->bubleUp(item.index);
 	}
 
-	template<typename N, typename E>
-	PriorityQueue<N, E>* BinaryHeap<N, E>::meld(PriorityQueue<N, E>* other)
+	template<typename N, typename E, typename Order>
+	PriorityQueue<N, E>* BinaryHeap<N, E, Order>::meld(PriorityQueue<N, E>* other)
 	{
-		// TODO implement O(n)
-		auto * otherBin = dynamic_cast<BinaryHeap<N, E> *>(other);
+		auto * otherBin = dynamic_cast<BinaryHeap<N, E, Order> *>(other);
 		
 		if (!otherBin)
 		{
 			throw std::logic_error("Queues must be of same type.");
 		}
 
-		for (BinaryHeapItem * oe : otherBin->data)
+		// items are moved, not copied, so entries of both heaps stay valid
+		const size_t oldSize = this->data.size();
+		this->data.insert(this->data.end(), otherBin->data.begin(), otherBin->data.end());
+		otherBin->data.clear();
+
+		for (size_t i = oldSize; i < this->data.size(); i++)
 		{
-			this->insert(oe->getData(), oe->getPrio());
+			this->data[i]->index = i;
 		}
 
-		otherBin->clear();
+		this->restoreHeap(oldSize);
 
 		return this;
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::clear()
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::clear()
 	{
 		for (BinaryHeapItem * item : this->data)
 		{
@@ -185,8 +235,14 @@ namespace uniza_fri {
 		this->data.clear();
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::ensureCapacity()
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::reserve(const size_t n)
+	{
+		this->data.reserve(n);
+	}
+
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::ensureCapacity()
 	{
 		if (this->data.capacity() == this->data.size())
 		{
@@ -194,8 +250,8 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::bubleUp(size_t index)
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::bubleUp(size_t index)
 	{
 		BinaryHeapItem * child = this->data[index];
 
@@ -204,7 +260,7 @@ namespace uniza_fri {
 			size_t parentIndex = (index - 1) >> 1;
 			BinaryHeapItem * parent = this->data[parentIndex];
 
-			if (!(*child < *parent)) break;
+			if (!Order::before(child->getPrio(), parent->getPrio())) break;
 
 			this->data[index] = parent;
 			parent->index = index;
@@ -215,8 +271,8 @@ namespace uniza_fri {
 		child->index = index;
 	}
 
-	template<typename N, typename E>
-	void BinaryHeap<N, E>::bubleDown(size_t index)
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::bubleDown(size_t index)
 	{
 		BinaryHeapItem * item = this->data[index];
 		const size_t leafBorder = this->data.size() >> 1;
@@ -225,10 +281,10 @@ namespace uniza_fri {
 		{
 			size_t childIndex = (index << 1) + 1;
 
-			if (childIndex < this->data.size() - 1 && *(this->data[childIndex + 1]) < *(this->data[childIndex]))
+			if (childIndex < this->data.size() - 1 && Order::before(this->data[childIndex + 1]->getPrio(), this->data[childIndex]->getPrio()))
 				childIndex++;
 
-			if (*item < *(this->data[childIndex])) break;
+			if (Order::before(item->getPrio(), this->data[childIndex]->getPrio())) break;
 
 			this->data[index] = this->data[childIndex];
 			this->data[index]->index = index;
@@ -239,5 +295,37 @@ namespace uniza_fri {
 		item->index = index;
 	}
 
-}
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::heapify()
+	{
+		for (size_t i = this->data.size() >> 1; i > 0; i--)
+		{
+			this->bubleDown(i - 1);
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void BinaryHeap<N, E, Order>::restoreHeap(const size_t firstNew)
+	{
+		const size_t newCount = this->data.size() - firstNew;
+
+		if (newCount == 0)
+		{
+			return;
+		}
+
+		// bubbling up costs up to log n per new item, bottom-up heapify n for the whole array
+		if (newCount * BitOps::highestSetBit(this->data.size()) >= this->data.size())
+		{
+			this->heapify();
+		}
+		else
+		{
+			for (size_t i = firstNew; i < this->data.size(); i++)
+			{
+				this->bubleUp(i);
+			}
+		}
+	}
 
+}
\ No newline at end of file
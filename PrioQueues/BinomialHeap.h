@@ -1,46 +1,93 @@
 #pragma once
 #include <stdexcept>
 #include <vector>
-#include <cmath>
+#include <algorithm>
+#include <type_traits>
 #include "PriorityQueue.h"
+#include "NodePool.h"
+#include "BitOps.h"
 
 #define ever ;;
 
 namespace uniza_fri {
 
-	template<typename N, typename E>
-	class BinomialHeap : public PriorityQueue<N, E>
+	/**
+		< Complexities >
+
+		                eager insert    lazy insert
+		insert		-> O(log n)        O(1)
+		findMin		-> O(1)            O(1)
+		decreaseKey	-> O(log n)        O(log n)
+		meld		-> O(log n)        O(log n + k)
+		deleteMin	-> O(log n)        O(log n + k)
+
+		k is the number of trees inserted since the last deleteMin.
+
+		< Template parameters >
+
+		Alloc      -> allocator of nodes and entries (NewAllocator, PoolAllocator).
+		LazyInsert -> if true, insert only prepends a tree of rank 0 to a pending list
+		              and the carries are done all at once by the next deleteMin.
+		Order      -> ordering policy (MinOrder, MaxOrder).
+
+		Tree of rank r is at roots[r]. A heap of n elements has a tree of rank r
+		exactly when bit r of n is set (without pending trees), so 64 slots suffice
+		and rootMask tells which of them are occupied. Root with the minimum is cached,
+		every operation that links trees keeps it up to date and deleteMin finds
+		the new one by scanning only the occupied slots.
+	*/
+	template<typename N, typename E, template<typename> class Alloc = NewAllocator, bool LazyInsert = false, typename Order = MinOrder<N>>
+	class BinomialHeap final : public PriorityQueue<N, E>
 	{
 	private:
 
 		class BinomialTreeNode;
 		class BinomialQueueEntry;
 
+		static const int MaxRank = 64;
+
 	private:
 
-		std::vector<BinomialTreeNode *> roots;
+		BinomialTreeNode * roots[MaxRank];
+		unsigned long long rootMask;
+		BinomialTreeNode * minRoot;
+		BinomialTreeNode * pending;
 		size_t dataSize;
+		Alloc<BinomialTreeNode> nodes;
+		Alloc<BinomialQueueEntry> entries;
 
 	public:
 
+		typedef BinomialQueueEntry entry_t;
+
 		BinomialHeap();
 		virtual ~BinomialHeap();
 
 		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename... Args>
+		QueueEntry<N, E> * emplace(N prio, Args &&... args);
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
 		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
 		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
 		E & findMin()                                           override;
 		size_t size()                                           override;
 		void clear()                                            override;
+		void reserve(size_t n)                                  override;
 
 	private:
 
+		void link(BinomialTreeNode * items, std::false_type lazy);
+		void link(BinomialTreeNode * items, std::true_type lazy);
 		void addItems(BinomialTreeNode * items);
-		BinomialTreeNode * findMaxPrioRoot();
-		int treesNeeded();
-		int treeCount();
-		void ensureCapacity();
+		void addPending();
+		BinomialTreeNode * findMinRoot() const;
+		int treeCount() const;
+		void destroyNodes();
 
 	private:
 
@@ -55,7 +102,7 @@ namespace uniza_fri {
 			BinomialTreeNode * next;
 			BinomialTreeNode * child;
 
-			BinomialTreeNode(const E & data, N prio);
+			BinomialTreeNode();
 			~BinomialTreeNode();
 			BinomialTreeNode * meld(BinomialTreeNode * other);
 			BinomialTreeNode * disconectChildren();
@@ -70,8 +117,10 @@ namespace uniza_fri {
 
 			BinomialTreeNode * node;
 
-			BinomialQueueEntry(const E & data, N prio, BinomialTreeNode * node);
-			virtual ~BinomialQueueEntry();
+			BinomialQueueEntry(E data, N prio, BinomialTreeNode * node);
+			template<typename... Args>
+			BinomialQueueEntry(emplace_tag tag, N prio, BinomialTreeNode * node, Args &&... args);
+			~BinomialQueueEntry();
 			void setPrio(N newPrio);
 
 		};
@@ -81,54 +130,116 @@ namespace uniza_fri {
 	//
 	//  BinomialHeap
 	//
-	template<typename N, typename E>
-	BinomialHeap<N, E>::BinomialHeap() :
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialHeap() :
+		rootMask(0),
+		minRoot(nullptr),
+		pending(nullptr),
 		dataSize(0)
 	{
-		this->roots.resize(4, nullptr);
+		std::fill(this->roots, this->roots + MaxRank, nullptr);
 	}
 
-	template<typename N, typename E>
-	BinomialHeap<N, E>::~BinomialHeap()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::~BinomialHeap()
 	{
 		this->clear();
 	}
 
-	template<typename N, typename E>
-	QueueEntry<N, E>* BinomialHeap<N, E>::insert(const E & data, N prio)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	QueueEntry<N, E>* BinomialHeap<N, E, Alloc, LazyInsert, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	QueueEntry<N, E>* BinomialHeap<N, E, Alloc, LazyInsert, Order>::insert(E && data, N prio)
+	{
+		BinomialTreeNode * node = this->nodes.create();
+		node->entry = this->entries.create(std::move(data), prio, node);
+
+		++this->dataSize;
+		this->link(node, std::integral_constant<bool, LazyInsert>());
+
+		return node->entry;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	template<typename... Args>
+	QueueEntry<N, E>* BinomialHeap<N, E, Alloc, LazyInsert, Order>::emplace(N prio, Args &&... args)
 	{
-		BinomialTreeNode * node = new BinomialTreeNode(data, prio);
+		BinomialTreeNode * node = this->nodes.create();
+		node->entry = this->entries.create(emplace_tag(), prio, node, std::forward<Args>(args)...);
 
 		++this->dataSize;
-		this->ensureCapacity();
-		this->addItems(node);
+		this->link(node, std::integral_constant<bool, LazyInsert>());
 
 		return node->entry;
 	}
 
-	template<typename N, typename E>
-	E BinomialHeap<N, E>::deleteMin()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt BinomialHeap<N, E, Alloc, LazyInsert, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		// new nodes are chained and linked into the trees in one pass
+		BinomialTreeNode * items = nullptr;
+
+		for (; first != last; ++first)
+		{
+			BinomialTreeNode * node = this->nodes.create();
+			node->entry = this->entries.create(first->first, first->second, node);
+			node->next = items;
+			items = node;
+
+			++this->dataSize;
+			*out++ = node->entry;
+		}
+
+		if (!items)
+		{
+			return out;
+		}
+
+		this->link(items, std::integral_constant<bool, LazyInsert>());
+
+		return out;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	std::pair<E, N> BinomialHeap<N, E, Alloc, LazyInsert, Order>::popMin()
 	{
 		if (this->isEmpty())
 		{
 			throw std::out_of_range("Priority queue is empty.");
 		}
 
-		BinomialTreeNode * max = this->findMaxPrioRoot();
-		E ret = max->entry->getData();
+		this->addPending();
 
-		this->roots[max->order] = nullptr;
-		BinomialTreeNode * children = max->disconectChildren();
-		delete max;
+		BinomialTreeNode * min = this->minRoot;
+		std::pair<E, N> ret(std::move(min->entry->getData()), min->entry->getPrio());
 
+		this->roots[min->order] = nullptr;
+		this->rootMask &= ~(1ULL << min->order);
+		BinomialTreeNode * children = min->disconectChildren();
+		this->entries.destroy(min->entry);
+		this->nodes.destroy(min);
+
+		this->minRoot = nullptr;
 		this->addItems(children);
+		this->minRoot = this->findMinRoot();
 
 		--this->dataSize;
 		return ret;
 	}
 
-	template<typename N, typename E>
-	E & BinomialHeap<N, E>::findMin()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	E BinomialHeap<N, E, Alloc, LazyInsert, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	E & BinomialHeap<N, E, Alloc, LazyInsert, Order>::findMin()
 	{
 		if (this->isEmpty())
 		{
@@ -136,22 +247,28 @@ namespace uniza_fri {
 		}
 		else
 		{
-			return this->findMaxPrioRoot()->entry->getData();
+			return this->minRoot->entry->getData();
 		}
 	}
 	
-	template<typename N, typename E>
-	size_t BinomialHeap<N, E>::size()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	size_t BinomialHeap<N, E, Alloc, LazyInsert, Order>::size()
 	{
 		return this->dataSize;
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::decreaseKey(entry_t & entry, N newPrio)
 	{
-		PriorityQueue<N, E>::decKeyLogicCheck(entry, newPrio);
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(entry, newPrio);
 
-		BinomialQueueEntry * binomialEntry = &(dynamic_cast<BinomialQueueEntry &>(entry));
+		BinomialQueueEntry * binomialEntry = &entry;
 		BinomialTreeNode * node = binomialEntry->node;
 		binomialEntry->setPrio(newPrio);
 
@@ -160,31 +277,52 @@ namespace uniza_fri {
 			node->parent->swapEntries(node);
 			node = node->parent;
 		}
+
+		if (!node->parent && *node < *this->minRoot)
+		{
+			this->minRoot = node;
+		}
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::clear()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::clear()
 	{
-		for (BinomialTreeNode * root : this->roots)
+		if (canReleaseAll<Alloc<BinomialQueueEntry>, N, E>())
 		{
-			if (root) delete root;
+			this->nodes.releaseAll();
+			this->entries.releaseAll();
+		}
+		else
+		{
+			this->destroyNodes();
 		}
 
+		std::fill(this->roots, this->roots + MaxRank, nullptr);
+		this->rootMask = 0;
+		this->minRoot = nullptr;
+		this->pending = nullptr;
 		this->dataSize = 0;
 	}
 
-	template<typename N, typename E>
-	PriorityQueue<N, E>* BinomialHeap<N, E>::meld(PriorityQueue<N, E>* other)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::reserve(const size_t n)
+	{
+		this->nodes.reserve(n);
+		this->entries.reserve(n);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	PriorityQueue<N, E>* BinomialHeap<N, E, Alloc, LazyInsert, Order>::meld(PriorityQueue<N, E>* other)
 	{
-		BinomialHeap<N, E>* otherBinomial = dynamic_cast<BinomialHeap<N, E>*>(other);
+		BinomialHeap<N, E, Alloc, LazyInsert, Order>* otherBinomial = dynamic_cast<BinomialHeap<N, E, Alloc, LazyInsert, Order>*>(other);
 		
 		if (!otherBinomial)
 		{
 			throw std::logic_error("Queues must be of same type.");
 		}
 
-		BinomialHeap<N, E> * from;
-		BinomialHeap<N, E> * to;
+		BinomialHeap<N, E, Alloc, LazyInsert, Order> * from;
+		BinomialHeap<N, E, Alloc, LazyInsert, Order> * to;
 
 		if (this->treeCount() < otherBinomial->treeCount())
 		{
@@ -200,22 +338,56 @@ namespace uniza_fri {
 		to->dataSize += from->dataSize;
 		from->dataSize = 0;
 
-		to->ensureCapacity();
+		to->addItems(from->pending);
+		from->pending = nullptr;
 
-		for (size_t i = 0; i < from->roots.size(); i++)
+		unsigned long long fromMask = from->rootMask;
+		while (fromMask)
 		{
-			if (!from->roots[i]) continue;
+			const int rank = BitOps::lowestSetBit(fromMask);
+			fromMask &= fromMask - 1;
 
-			from->roots[i]->next = nullptr;
-			to->addItems(from->roots[i]);
-			from->roots[i] = nullptr;
+			from->roots[rank]->next = nullptr;
+			to->addItems(from->roots[rank]);
+			from->roots[rank] = nullptr;
 		}
 
+		from->rootMask = 0;
+		from->minRoot = nullptr;
+
+		to->nodes.absorb(from->nodes);
+		to->entries.absorb(from->entries);
+
 		return to;
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::addItems(BinomialTreeNode * items)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::link(BinomialTreeNode * items, std::false_type)
+	{
+		this->addItems(items);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::link(BinomialTreeNode * items, std::true_type)
+	{
+		// no carries, the chain is only put in front of the pending trees
+		BinomialTreeNode * last = nullptr;
+		for (BinomialTreeNode * item = items; item; item = item->next)
+		{
+			if (!this->minRoot || *item < *this->minRoot)
+			{
+				this->minRoot = item;
+			}
+
+			last = item;
+		}
+
+		last->next = this->pending;
+		this->pending = items;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::addItems(BinomialTreeNode * items)
 	{
 		BinomialTreeNode * item = items;
 		while (item)
@@ -224,124 +396,134 @@ namespace uniza_fri {
 
 			for (ever)
 			{
-				if (!this->roots[item->order]) 
+				const unsigned long long rankBit = 1ULL << item->order;
+
+				if (!(this->rootMask & rankBit))
 				{
 					this->roots[item->order] = item;
+					this->rootMask |= rankBit;
 					break;
 				}
 				else 
 				{
-					item = this->roots[item->order]->meld(item);
-					this->roots[item->order - 1] = nullptr;
+					BinomialTreeNode * other = this->roots[item->order];
+					this->roots[item->order] = nullptr;
+					this->rootMask &= ~rankBit;
+
+					BinomialTreeNode * winner = other->meld(item);
+
+					// on equal priorities the cached root may end up under the other one
+					if (this->minRoot == other || this->minRoot == item)
+					{
+						this->minRoot = winner;
+					}
+
+					item = winner;
 				}
 			}
 
+			if (!this->minRoot || *item < *this->minRoot)
+			{
+				this->minRoot = item;
+			}
+
 			item = nextItem;
 		}
 	}
 
-	template<typename N, typename E>
-	auto BinomialHeap<N, E>::findMaxPrioRoot() -> BinomialTreeNode *
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::addPending()
 	{
-		BinomialTreeNode * max(nullptr);
-
-		size_t fromI(0);
-		const size_t treeNeed = static_cast<size_t>(this->treesNeeded());
-		for (size_t i = 0; i <= treeNeed; i++)
+		if (this->pending)
 		{
-			if (this->roots[i])
-			{
-				max = this->roots[i];
-				fromI = i + 1;
-				break;
-			}
+			this->addItems(this->pending);
+			this->pending = nullptr;
 		}
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	auto BinomialHeap<N, E, Alloc, LazyInsert, Order>::findMinRoot() const -> BinomialTreeNode *
+	{
+		BinomialTreeNode * min(nullptr);
 
-		for (size_t i = fromI; i <= treeNeed; i++)
+		unsigned long long mask = this->rootMask;
+		while (mask)
 		{
-			if (!this->roots[i]) continue;
-			
-			if (*this->roots[i] < *max)
+			BinomialTreeNode * root = this->roots[BitOps::lowestSetBit(mask)];
+			mask &= mask - 1;
+
+			if (!min || *root < *min)
 			{
-				max = this->roots[i];
+				min = root;
 			}
 		}
 
-		return max;
+		return min;
 	}
 
-	template<typename N, typename E>
-	int BinomialHeap<N, E>::treesNeeded()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	int BinomialHeap<N, E, Alloc, LazyInsert, Order>::treeCount() const
 	{
-		// TODO bitwise
-		return static_cast<int>(ceil(log2(this->dataSize)));
+		return BitOps::bitCount(this->rootMask);
 	}
 
-	template<typename N, typename E>
-	int BinomialHeap<N, E>::treeCount()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::destroyNodes()
 	{
-		int count(0);
-		const int trNeed = this->treesNeeded();
-		
-		for (int i = 0; i < trNeed; i++)
+		// nodes do not delete their children, the whole forest is walked here
+		std::vector<BinomialTreeNode*> stack;
+		for (BinomialTreeNode * root : this->roots)
 		{
-			if (this->roots[i])
-			{
-				count++;
-			}
+			if (root) stack.push_back(root);
 		}
-		
-		return count;
-	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::ensureCapacity()
-	{
-		if (static_cast<size_t>(this->treesNeeded()) >= this->roots.size())
+		for (BinomialTreeNode * root = this->pending; root; root = root->next)
 		{
-			this->roots.resize(this->dataSize << 1, nullptr);
+			stack.push_back(root);
+		}
+
+		while (!stack.empty())
+		{
+			BinomialTreeNode * node = stack.back();
+			stack.pop_back();
+
+			BinomialTreeNode * child = node->disconectChildren();
+			while (child)
+			{
+				stack.push_back(child);
+				child = child->next;
+			}
+
+			this->entries.destroy(node->entry);
+			this->nodes.destroy(node);
 		}
 	}
 
 	//
 	//  BinomialTreeNode
 	//
-	template<typename N, typename E>
-	BinomialHeap<N, E>::BinomialTreeNode::BinomialTreeNode(const E & data, N prio) :
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::BinomialTreeNode() :
+		entry(nullptr),
 		order(0),
 		parent(nullptr),
 		next(nullptr),
-		child(nullptr),
-		entry(new BinomialQueueEntry(data, prio, this))
+		child(nullptr)
 	{
 	}
 
-	template<typename N, typename E>
-	BinomialHeap<N, E>::BinomialTreeNode::~BinomialTreeNode()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::~BinomialTreeNode()
 	{
-		if (this->child != nullptr)
-		{
-			BinomialTreeNode * it = this->child->next;
-			this->child->next = nullptr;
-			while (it != nullptr)
-			{
-				BinomialTreeNode * nextIt = it->next;
-				delete it;
-				it = nextIt;
-			}
-		}
-
 		this->order = -1;
 		this->parent = nullptr;
 		this->next = nullptr;
 		this->child = nullptr;
-
-		delete this->entry;
 		this->entry = nullptr;
 	}
 
-	template<typename N, typename E>
-	auto BinomialHeap<N, E>::BinomialTreeNode::meld(BinomialTreeNode * other) -> BinomialTreeNode *
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	auto BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::meld(BinomialTreeNode * other) -> BinomialTreeNode *
 	{
 		if (*this < *other) {
 			this->addChild(other);
@@ -354,8 +536,8 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::BinomialTreeNode::addChild(BinomialTreeNode * chld)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::addChild(BinomialTreeNode * chld)
 	{
 		if (!this->child)
 		{
@@ -374,8 +556,8 @@ namespace uniza_fri {
 		++this->order;
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::BinomialTreeNode::swapEntries(BinomialTreeNode * other)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::swapEntries(BinomialTreeNode * other)
 	{
 		BinomialQueueEntry * tmpEntry = other->entry;
 		other->entry = this->entry;
@@ -385,14 +567,14 @@ namespace uniza_fri {
 		this->entry->node = this;
 	}
 
-	template<typename N, typename E>
-	bool BinomialHeap<N, E>::BinomialTreeNode::operator<(const BinomialTreeNode & other) const
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	bool BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::operator<(const BinomialTreeNode & other) const
 	{
-		return *(this->entry) < *(other.entry);
+		return Order::before(this->entry->getPrio(), other.entry->getPrio());
 	}
 
-	template<typename N, typename E>
-	auto BinomialHeap<N, E>::BinomialTreeNode::disconectChildren() -> BinomialTreeNode *
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	auto BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialTreeNode::disconectChildren() -> BinomialTreeNode *
 	{
 		if (!this->child)
 		{
@@ -418,20 +600,28 @@ namespace uniza_fri {
 	//
 	// BinomialQueueEntry
 	//
-	template<typename N, typename E>
-	BinomialHeap<N, E>::BinomialQueueEntry::BinomialQueueEntry(const E & data, N prio, BinomialTreeNode * pNode) :
-		QueueEntry<N, E>(data, prio),
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialQueueEntry::BinomialQueueEntry(E data, N prio, BinomialTreeNode * pNode) :
+		QueueEntry<N, E>(std::move(data), prio),
+		node(pNode)
+	{
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	template<typename... Args>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialQueueEntry::BinomialQueueEntry(emplace_tag tag, N prio, BinomialTreeNode * pNode, Args &&... args) :
+		QueueEntry<N, E>(tag, prio, std::forward<Args>(args)...),
 		node(pNode)
 	{
 	}
 
-	template<typename N, typename E>
-	BinomialHeap<N, E>::BinomialQueueEntry::~BinomialQueueEntry()
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialQueueEntry::~BinomialQueueEntry()
 	{
 	}
 
-	template<typename N, typename E>
-	void BinomialHeap<N, E>::BinomialQueueEntry::setPrio(N newPrio)
+	template<typename N, typename E, template<typename> class Alloc, bool LazyInsert, typename Order>
+	void BinomialHeap<N, E, Alloc, LazyInsert, Order>::BinomialQueueEntry::setPrio(N newPrio)
 	{
 		QueueEntry<N, E>::setPrioInternal(newPrio);
 	}
@@ -0,0 +1,95 @@
+#pragma once
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace uniza_fri {
+
+	/**
+		Small bit manipulation helpers used by the integer based queues.
+	*/
+	class BitOps
+	{
+	public:
+
+		/**
+			@return Index of the highest set bit of val. val must not be 0.
+		*/
+		static int highestSetBit(unsigned long long val);
+
+		/**
+			@return Index of the lowest set bit of val. val must not be 0.
+		*/
+		static int lowestSetBit(unsigned long long val);
+
+		/**
+			@return Number of set bits of val.
+		*/
+		static int bitCount(unsigned long long val);
+
+		/**
+			Compile time variant of highestSetBit.
+			@return Index of the highest set bit of val, 0 for val 0.
+		*/
+		static constexpr int floorLog2(unsigned long long val);
+
+	};
+
+	inline int BitOps::highestSetBit(unsigned long long val)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanReverse64(&index, val);
+		return static_cast<int>(index);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		if (val >> 32)
+		{
+			_BitScanReverse(&index, static_cast<unsigned long>(val >> 32));
+			return static_cast<int>(index) + 32;
+		}
+		_BitScanReverse(&index, static_cast<unsigned long>(val));
+		return static_cast<int>(index);
+#else
+		return 63 - __builtin_clzll(val);
+#endif
+	}
+
+	inline int BitOps::lowestSetBit(unsigned long long val)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanForward64(&index, val);
+		return static_cast<int>(index);
+#elif defined(_MSC_VER)
+		unsigned long index;
+		if (static_cast<unsigned long>(val) == 0)
+		{
+			_BitScanForward(&index, static_cast<unsigned long>(val >> 32));
+			return static_cast<int>(index) + 32;
+		}
+		_BitScanForward(&index, static_cast<unsigned long>(val));
+		return static_cast<int>(index);
+#else
+		return __builtin_ctzll(val);
+#endif
+	}
+
+	inline int BitOps::bitCount(unsigned long long val)
+	{
+#if defined(_MSC_VER) && defined(_WIN64)
+		return static_cast<int>(__popcnt64(val));
+#elif defined(_MSC_VER)
+		return static_cast<int>(__popcnt(static_cast<unsigned int>(val)) + __popcnt(static_cast<unsigned int>(val >> 32)));
+#else
+		return __builtin_popcountll(val);
+#endif
+	}
+
+	constexpr int BitOps::floorLog2(unsigned long long val)
+	{
+		return val > 1 ? 1 + floorLog2(val >> 1) : 0;
+	}
+
+}
\ No newline at end of file
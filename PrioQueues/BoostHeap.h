@@ -0,0 +1,282 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+#include <boost/heap/fibonacci_heap.hpp>
+#include <boost/heap/pairing_heap.hpp>
+#include <boost/heap/binomial_heap.hpp>
+#include <boost/heap/skew_heap.hpp>
+#include <boost/heap/d_ary_heap.hpp>
+#include "PriorityQueue.h"
+
+namespace uniza_fri {
+
+	/**
+		Kinds of Boost.Heap containers BoostHeap can wrap. Each one provides
+		heap_t<T, Compare>, a mutable heap (with handles) of T ordered by Compare,
+		and use_merge, whether BoostHeap melds it by the merge of the container.
+		binomial_heap::merge corrupts memory (Boost 1.74, merge_and_clear_nodes
+		writes past its buffer), so it is melded by pushing like d_ary_heap.
+	*/
+	struct boost_fibonacci
+	{
+		template<typename T, typename Compare>
+		using heap_t = boost::heap::fibonacci_heap<T, boost::heap::compare<Compare>>;
+
+		static const bool use_merge = true;
+	};
+
+	struct boost_pairing
+	{
+		template<typename T, typename Compare>
+		using heap_t = boost::heap::pairing_heap<T, boost::heap::compare<Compare>>;
+
+		static const bool use_merge = true;
+	};
+
+	struct boost_binomial
+	{
+		template<typename T, typename Compare>
+		using heap_t = boost::heap::binomial_heap<T, boost::heap::compare<Compare>>;
+
+		static const bool use_merge = false;
+	};
+
+	struct boost_skew
+	{
+		template<typename T, typename Compare>
+		using heap_t = boost::heap::skew_heap<T, boost::heap::compare<Compare>, boost::heap::mutable_<true>>;
+
+		static const bool use_merge = true;
+	};
+
+	template<int D>
+	struct boost_d_ary
+	{
+		template<typename T, typename Compare>
+		using heap_t = boost::heap::d_ary_heap<T, boost::heap::compare<Compare>, boost::heap::arity<D>, boost::heap::mutable_<true>>;
+
+		static const bool use_merge = false;
+	};
+
+	/**
+		< Template parameters >
+
+		Kind -> boost_fibonacci, boost_pairing, boost_binomial, boost_skew or boost_d_ary<D>.
+
+		Adapter of a Boost.Heap container to PriorityQueue. The container holds pointers
+		to entries and every entry keeps the handle of its element, which is what decreaseKey uses.
+		Boost heaps are max-heaps, so Comparator is inverted and decreaseKey calls increase.
+		Heaps with Kind::use_merge are melded by their merge, others (binomial_heap, d_ary_heap)
+		by pushing the elements of the other heap, which gives their entries new handles.
+	*/
+	template<typename N, typename E, typename Kind>
+	class BoostHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class BoostHeapEntry;
+
+		struct Comparator
+		{
+			bool operator()(const BoostHeapEntry * e1, const BoostHeapEntry * e2) const;
+		};
+
+		typedef typename Kind::template heap_t<BoostHeapEntry*, Comparator> heap_t;
+		typedef typename heap_t::handle_type handle_t;
+
+		class BoostHeapEntry : public QueueEntry<N, E>
+		{
+		public:
+
+			handle_t handle;
+
+			BoostHeapEntry(E data, N prio);
+
+			void setPrio(N prio);
+
+		};
+
+	private:
+
+		heap_t heap;
+
+	public:
+
+		typedef BoostHeapEntry entry_t;
+
+		BoostHeap();
+		virtual ~BoostHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N prio)      override;
+		void decreaseKey(entry_t & entry, N prio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+
+	private:
+
+		void absorb(BoostHeap<N, E, Kind> & other, std::true_type merge);
+		void absorb(BoostHeap<N, E, Kind> & other, std::false_type merge);
+
+	};
+
+	//
+	// BoostHeap
+	//
+	template<typename N, typename E, typename Kind>
+	BoostHeap<N, E, Kind>::BoostHeap()
+	{
+
+	}
+
+	template<typename N, typename E, typename Kind>
+	BoostHeap<N, E, Kind>::~BoostHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, typename Kind>
+	QueueEntry<N, E>* BoostHeap<N, E, Kind>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, typename Kind>
+	QueueEntry<N, E>* BoostHeap<N, E, Kind>::insert(E && data, N prio)
+	{
+		BoostHeapEntry * entry(new BoostHeapEntry(std::move(data), prio));
+		entry->handle = this->heap.push(entry);
+
+		return entry;
+	}
+
+	template<typename N, typename E, typename Kind>
+	std::pair<E, N> BoostHeap<N, E, Kind>::popMin()
+	{
+		if (this->heap.empty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		BoostHeapEntry * entry(this->heap.top());
+		this->heap.pop();
+		std::pair<E, N> ret(std::move(entry->getData()), entry->getPrio());
+		delete entry;
+		return ret;
+	}
+
+	template<typename N, typename E, typename Kind>
+	E BoostHeap<N, E, Kind>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Kind>
+	E & BoostHeap<N, E, Kind>::findMin()
+	{
+		if (this->heap.empty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+		else
+		{
+			return this->heap.top()->getData();
+		}
+	}
+
+	template<typename N, typename E, typename Kind>
+	size_t BoostHeap<N, E, Kind>::size()
+	{
+		return this->heap.size();
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::decreaseKey(QueueEntry<N, E>& entry, N prio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), prio);
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::decreaseKey(entry_t & boostEntry, N prio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(boostEntry, prio);
+
+		boostEntry.setPrio(prio);
+		this->heap.increase(boostEntry.handle);
+	}
+
+	template<typename N, typename E, typename Kind>
+	PriorityQueue<N, E>* BoostHeap<N, E, Kind>::meld(PriorityQueue<N, E>* other)
+	{
+		auto * otherBoost = dynamic_cast<BoostHeap<N, E, Kind> *>(other);
+
+		if (!otherBoost)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		this->absorb(*otherBoost, std::integral_constant<bool, Kind::use_merge>());
+
+		return this;
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::clear()
+	{
+		for (BoostHeapEntry * entry : this->heap)
+		{
+			delete entry;
+		}
+
+		this->heap.clear();
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::absorb(BoostHeap<N, E, Kind> & other, std::true_type)
+	{
+		// nodes are relinked, handles of both heaps stay valid
+		this->heap.merge(other.heap);
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::absorb(BoostHeap<N, E, Kind> & other, std::false_type)
+	{
+		for (BoostHeapEntry * entry : other.heap)
+		{
+			entry->handle = this->heap.push(entry);
+		}
+
+		other.heap.clear();
+	}
+
+	//
+	// Comparator
+	//
+	template<typename N, typename E, typename Kind>
+	bool BoostHeap<N, E, Kind>::Comparator::operator()(const BoostHeapEntry * e1, const BoostHeapEntry * e2) const
+	{
+		return e2->getPrio() < e1->getPrio();
+	}
+
+	//
+	// BoostHeapEntry
+	//
+	template<typename N, typename E, typename Kind>
+	BoostHeap<N, E, Kind>::BoostHeapEntry::BoostHeapEntry(E data, N prio) :
+		QueueEntry<N, E>(std::move(data), prio)
+	{
+	}
+
+	template<typename N, typename E, typename Kind>
+	void BoostHeap<N, E, Kind>::BoostHeapEntry::setPrio(N prio)
+	{
+		QueueEntry<N, E>::setPrioInternal(prio);
+	}
+
+}
\ No newline at end of file
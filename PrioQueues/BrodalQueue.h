@@ -17,7 +17,7 @@ namespace uniza_fri {
 	*/
 
 	template<typename N, typename E>
-	class BrodalQueue : public PriorityQueue<N, E>
+	class BrodalQueue final : public PriorityQueue<N, E>
 	{
 	private:
 		// Forward declarations of nested classes
@@ -36,14 +36,19 @@ namespace uniza_fri {
 
 	public:
 
+		typedef BrodalEntry entry_t;
+
 		BrodalQueue();
 		virtual ~BrodalQueue();
 
 		// Implementation of the PriorityQueue interface
 		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
 		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
 		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
 		E & findMin()                                           override;
 		size_t size()                                           override;
 		void clear()                                            override;
@@ -198,8 +203,8 @@ namespace uniza_fri {
 
 		public:
 
-			BrodalEntry(const E & data, N prio, BrodalNode * pNode);
-			virtual ~BrodalEntry();
+			BrodalEntry(E data, N prio, BrodalNode * pNode);
+			~BrodalEntry();
 			BrodalNode * getItem();
 			void setItem(BrodalNode * pItem);
 			void setPrio(N newPrio);
@@ -232,7 +237,7 @@ namespace uniza_fri {
 
 		public:
 
-			BrodalNode(const E & data, N prio);
+			BrodalNode(E data, N prio);
 			~BrodalNode();
 
 			int getRank();
@@ -458,7 +463,13 @@ namespace uniza_fri {
 	template<typename N, typename E>
 	QueueEntry<N, E>* BrodalQueue<N, E>::insert(const E & data, N prio)
 	{
-		auto* newItem = new BrodalNode(data, prio);
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E>* BrodalQueue<N, E>::insert(E && data, N prio)
+	{
+		auto* newItem = new BrodalNode(std::move(data), prio);
 		QueueEntry<N, E> * retEntry = newItem->entry;
 
 		++this->dataSize;
@@ -497,14 +508,17 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename E>
-	E BrodalQueue<N, E>::deleteMin()
+	std::pair<E, N> BrodalQueue<N, E>::popMin()
 	{
 		if (this->isEmpty())
 		{
 			throw std::out_of_range("Priority queue is empty.");
 		}
 
-		E ret = this->findMin();
+		this->increaseRankOfT1();
+
+		QueueEntry<N, E> * minEntry = this->t1Wrap->getRootItem()->getEntry();
+		std::pair<E, N> ret(std::move(minEntry->getData()), minEntry->getPrio());
 		--this->dataSize;
 
 		BrodalNode * nodeToDelete;
@@ -568,6 +582,12 @@ namespace uniza_fri {
 		return ret;
 	}
 
+	template<typename N, typename E>
+	E BrodalQueue<N, E>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
 	template<typename N, typename E>
 	E & BrodalQueue<N, E>::findMin()
 	{
@@ -591,12 +611,18 @@ namespace uniza_fri {
 
 	template<typename N, typename E>
 	void BrodalQueue<N, E>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E>
+	void BrodalQueue<N, E>::decreaseKey(entry_t & entry, N newPrio)
 	{
 		PriorityQueue<N, E>::decKeyLogicCheck(entry, newPrio);
 
 		this->increaseRankOfT1();
 
-		BrodalEntry * brodalEntry = &dynamic_cast<BrodalEntry &>(entry);
+		BrodalEntry * brodalEntry = &entry;
 		BrodalNode * item = brodalEntry->getItem();
 
 		brodalEntry->setPrio(newPrio);
@@ -971,8 +997,8 @@ namespace uniza_fri {
 	// BrodalEntry
 	//
 	template<typename N, typename E>
-	BrodalQueue<N, E>::BrodalEntry::BrodalEntry(const E & data, N prio, BrodalNode * pNode) :
-		QueueEntry<N, E>(data, prio),
+	BrodalQueue<N, E>::BrodalEntry::BrodalEntry(E data, N prio, BrodalNode * pNode) :
+		QueueEntry<N, E>(std::move(data), prio),
 		item(pNode)
 	{
 	}
@@ -1004,9 +1030,9 @@ namespace uniza_fri {
 	// BrodalNode
 	//
 	template<typename N, typename E>
-	BrodalQueue<N, E>::BrodalNode::BrodalNode(const E & data, N prio) :
+	BrodalQueue<N, E>::BrodalNode::BrodalNode(E data, N prio) :
 		rank(0),
-		entry(new BrodalEntry(data, prio, this)),
+		entry(new BrodalEntry(std::move(data), prio, this)),
 		parent(nullptr),
 		prev(nullptr),
 		next(nullptr),
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PriorityQueue.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(1) amortized
+		findMin		-> O(C) amortized over a monotone run, C is the maximal edge weight
+		decreaseKey	-> O(1)
+		meld		-> O(n + m + C)
+		deleteMin	-> O(C) amortized over a monotone run
+
+		Dial's bucket queue for integer priorities. Buckets form a circular array
+		indexed by priority modulo the bucket count. Every bucket is an intrusive doubly
+		linked list, so decreaseKey only unlinks the item and links it to another bucket.
+
+		Buckets are indexed by the priority itself, so the difference between the highest
+		and the lowest priority in the queue must be lower than the bucket count.
+		In Dijkstra's algorithm it is at most C, so with maxEdgeCost given to the constructor
+		the buckets are allocated once. Dijkstra does so with the maximal arc cost of the graph
+		(see has_bounded_span). Otherwise the span is inferred: whenever a priority
+		does not fit, the bucket count is doubled and the items are redistributed.
+		Infinite priorities therefore do not fit, so the queue cannot be used
+		in the basic Dijkstra, which inserts all vertices at the maximal distance.
+
+		Priorities inserted or decreased must never be lower than the last extracted
+		minimum, throws std::invalid_argument otherwise. When the queue becomes
+		empty the restriction is lifted.
+	*/
+	template<typename N, typename E>
+	class BucketQueue final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class BucketQueueItem;
+
+	private:
+
+		std::vector<BucketQueueItem*> buckets;
+		size_t mask;
+		N cursor;
+		N top;
+		N lastMin;
+		size_t dataSize;
+
+	public:
+
+		typedef BucketQueueItem entry_t;
+
+		explicit BucketQueue(size_t maxEdgeCost = 0);
+		virtual ~BucketQueue();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+
+	private:
+
+		void link(BucketQueueItem * item);
+		void unlink(BucketQueueItem * item);
+		void extendSpan(N prio);
+		void advance();
+		void checkMonotone(N prio) const;
+
+	private:
+
+		class BucketQueueItem : public QueueEntry<N, E>
+		{
+		public:
+
+			BucketQueueItem * prev;
+			BucketQueueItem * next;
+
+			BucketQueueItem(E pData, N pPrio);
+			~BucketQueueItem() = default;
+			void setPrio(N newPrio);
+			size_t bucket(size_t mask) const;
+
+		};
+
+	};
+
+	//
+	// BucketQueueItem
+	//
+	template<typename N, typename E>
+	BucketQueue<N, E>::BucketQueueItem::BucketQueueItem(E pData, N pPrio) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		prev(nullptr),
+		next(nullptr)
+	{
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::BucketQueueItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	template<typename N, typename E>
+	size_t BucketQueue<N, E>::BucketQueueItem::bucket(const size_t mask) const
+	{
+		return static_cast<size_t>(this->getPrio()) & mask;
+	}
+
+	//
+	// BucketQueue
+	//
+	template<typename N, typename E>
+	BucketQueue<N, E>::BucketQueue(const size_t maxEdgeCost) :
+		mask(0),
+		cursor(0),
+		top(0),
+		lastMin(std::numeric_limits<N>::lowest()),
+		dataSize(0)
+	{
+		static_assert(std::is_integral<N>::value, "BucketQueue requires integral priorities.");
+
+		// bucket count is a power of two so that the modulo is a mask
+		size_t bucketCount = 1;
+		while (bucketCount <= maxEdgeCost)
+		{
+			bucketCount <<= 1;
+		}
+
+		this->buckets.resize(bucketCount, nullptr);
+		this->mask = bucketCount - 1;
+	}
+
+	template<typename N, typename E>
+	BucketQueue<N, E>::~BucketQueue()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E> * BucketQueue<N, E>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E> * BucketQueue<N, E>::insert(E && data, N prio)
+	{
+		this->checkMonotone(prio);
+
+		if (this->isEmpty())
+		{
+			this->cursor = prio;
+			this->top = prio;
+		}
+
+		this->extendSpan(prio);
+
+		auto * item = new BucketQueueItem(std::move(data), prio);
+		this->link(item);
+		++this->dataSize;
+
+		return item;
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(item, newPrio);
+		this->checkMonotone(newPrio);
+
+		this->unlink(&item);
+		item.setPrio(newPrio);
+		this->extendSpan(newPrio);
+		this->link(&item);
+	}
+
+	template<typename N, typename E>
+	PriorityQueue<N, E> * BucketQueue<N, E>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherBucket = dynamic_cast<BucketQueue<N, E> *>(other);
+
+		if (!otherBucket)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		if (otherBucket->isEmpty())
+		{
+			return this;
+		}
+
+		if (this->isEmpty())
+		{
+			this->cursor = otherBucket->cursor;
+			this->top = otherBucket->top;
+		}
+
+		this->lastMin = std::min(this->lastMin, otherBucket->lastMin);
+		this->extendSpan(otherBucket->cursor);
+		this->extendSpan(otherBucket->top);
+
+		for (BucketQueueItem *& head : otherBucket->buckets)
+		{
+			while (head)
+			{
+				BucketQueueItem * nextIt = head->next;
+				this->link(head);
+				head = nextIt;
+			}
+		}
+
+		this->dataSize += otherBucket->dataSize;
+		otherBucket->dataSize = 0;
+		otherBucket->lastMin = std::numeric_limits<N>::lowest();
+
+		return this;
+	}
+
+	template<typename N, typename E>
+	std::pair<E, N> BucketQueue<N, E>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		this->advance();
+
+		BucketQueueItem * poped = this->buckets[static_cast<size_t>(this->cursor) & this->mask];
+		this->unlink(poped);
+		this->lastMin = this->cursor;
+
+		if (--this->dataSize == 0)
+		{
+			this->lastMin = std::numeric_limits<N>::lowest();
+		}
+
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		return popedData;
+	}
+
+	template<typename N, typename E>
+	E BucketQueue<N, E>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E>
+	E & BucketQueue<N, E>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		this->advance();
+
+		return this->buckets[static_cast<size_t>(this->cursor) & this->mask]->getData();
+	}
+
+	template<typename N, typename E>
+	size_t BucketQueue<N, E>::size()
+	{
+		return this->dataSize;
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::clear()
+	{
+		for (BucketQueueItem *& head : this->buckets)
+		{
+			while (head)
+			{
+				BucketQueueItem * nextIt = head->next;
+				delete head;
+				head = nextIt;
+			}
+		}
+
+		this->cursor = 0;
+		this->top = 0;
+		this->lastMin = std::numeric_limits<N>::lowest();
+		this->dataSize = 0;
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::link(BucketQueueItem * item)
+	{
+		BucketQueueItem *& head = this->buckets[item->bucket(this->mask)];
+
+		item->prev = nullptr;
+		item->next = head;
+
+		if (head)
+		{
+			head->prev = item;
+		}
+
+		head = item;
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::unlink(BucketQueueItem * item)
+	{
+		if (item->prev)
+		{
+			item->prev->next = item->next;
+		}
+		else
+		{
+			this->buckets[item->bucket(this->mask)] = item->next;
+		}
+
+		if (item->next)
+		{
+			item->next->prev = item->prev;
+		}
+
+		item->prev = nullptr;
+		item->next = nullptr;
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::extendSpan(N prio)
+	{
+		if (prio < this->cursor)
+		{
+			this->cursor = prio;
+		}
+		else if (this->top < prio)
+		{
+			this->top = prio;
+		}
+
+		const size_t span = static_cast<size_t>(this->top - this->cursor);
+
+		if (span <= this->mask)
+		{
+			return;
+		}
+
+		size_t bucketCount = this->buckets.size();
+		while (bucketCount <= span)
+		{
+			bucketCount <<= 1;
+		}
+
+		std::vector<BucketQueueItem*> oldBuckets(bucketCount, nullptr);
+		oldBuckets.swap(this->buckets);
+		this->mask = bucketCount - 1;
+
+		for (BucketQueueItem * head : oldBuckets)
+		{
+			while (head)
+			{
+				BucketQueueItem * nextIt = head->next;
+				this->link(head);
+				head = nextIt;
+			}
+		}
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::advance()
+	{
+		while (!this->buckets[static_cast<size_t>(this->cursor) & this->mask])
+		{
+			++this->cursor;
+		}
+	}
+
+	template<typename N, typename E>
+	void BucketQueue<N, E>::checkMonotone(N prio) const
+	{
+		if (prio < this->lastMin)
+		{
+			throw std::invalid_argument("Priority must not be lower than the last extracted minimum.");
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "Graph.h"
+#include "vid_t.h"
+
+namespace uniza_fri {
+
+	/*
+		Graf uloen vo formte CSR (compressed sparse row). Dopredn hviezda
+		vrcholu v je sek [offsets[v], offsets[v + 1]) v poliach targets a costs,
+		take prechod hranami je linerny prechod svislou pamou bez alokcie
+		pre kad hranu a bez virtulneho volania.
+
+		Graf sa najprv napa rovnako ako Graph (addVertex, addEdgeBi, addEdgeOriented),
+		hrany sa vak len odkladaj. A metda build ich usporiada do pol CSR.
+		Dovtedy sa dopredn hviezdu ned prechdza.
+
+		Po zostaven sa graf u nemen, dta hadania si dr hadanie samo
+		(viz. DijkstraContext), take jeden graf me zdiea viac hadan naraz.
+
+		N -> dtov typ ohodnotenia hrn.
+	 */
+	template<typename N>
+	class CsrGraph
+	{
+	public:
+
+		/*
+			Itertor doprednej hviezdy, ide sbene po poliach cieov a ohodnoten.
+		 */
+		class ArcIterator
+		{
+		private:
+
+			const vid_t * target;
+			const N * cost;
+
+		public:
+
+			ArcIterator(const vid_t * pTarget, const N * pCost);
+			bool operator!=(const ArcIterator & other) const;
+			Arc<N> operator*() const;
+			ArcIterator & operator++();
+
+		};
+
+	private:
+
+		/*
+			Hrana odloen pred zostavenm grafu.
+		 */
+		struct PendingEdge
+		{
+			vid_t src;
+			vid_t dst;
+			N cost;
+			bool bidirectional;
+		};
+
+	private:
+
+		std::string name;
+		N zeroDist;
+		N maxDist;
+		N maxArcCost;
+		size_t vertexCount;
+		std::vector<bool> present;
+		std::vector<size_t> offsets;
+		std::vector<vid_t> targets;
+		std::vector<N> costs;
+		std::vector<PendingEdge> pending;
+		bool built;
+
+	public:
+
+		CsrGraph(std::string pname, const N & zeroDistance, const N & maxDistance, size_t maxVertexCount = 100);
+		~CsrGraph() = default;
+
+		const std::string & getName() const;
+
+		N getZeroDist() const;
+		N getMaxDist() const;
+		N getMaxArcCost() const;
+		ArcRange<ArcIterator> forwardStar(const vid_t & vertexID) const;
+		size_t getVertexCount() const;
+		size_t getEdgeCount() const;
+		vid_t getIdBound() const;
+		bool vertexExists(const vid_t & vertexID) const;
+
+		void addVertex(const vid_t & vertexID);
+		void addEdgeBi(const vid_t & vid1, const vid_t & vid2, const N & cost);
+		void addEdgeOriented(const vid_t & vidSrc, const vid_t & vidDst, const N & cost);
+		void build();
+
+	private:
+
+		void checkEdgeEnds(const vid_t & vid1, const vid_t & vid2);
+
+	};
+
+	//
+	// CsrGraph
+	//
+	template<typename N>
+	CsrGraph<N>::CsrGraph(std::string pname, const N & zeroDistance, const N & maxDistance, const size_t maxVertexCount) :
+		name(std::move(pname)),
+		zeroDist(zeroDistance),
+		maxDist(maxDistance),
+		maxArcCost(zeroDistance),
+		vertexCount(0),
+		built(false)
+	{
+		this->present.resize(maxVertexCount, false);
+	}
+
+	template<typename N>
+	const std::string & CsrGraph<N>::getName() const
+	{
+		return this->name;
+	}
+
+	template<typename N>
+	N CsrGraph<N>::getZeroDist() const
+	{
+		return this->zeroDist;
+	}
+
+	template<typename N>
+	N CsrGraph<N>::getMaxDist() const
+	{
+		return this->maxDist;
+	}
+
+	template<typename N>
+	N CsrGraph<N>::getMaxArcCost() const
+	{
+		return this->maxArcCost;
+	}
+
+	template<typename N>
+	auto CsrGraph<N>::forwardStar(const vid_t & vertexID) const -> ArcRange<ArcIterator>
+	{
+		const size_t first = this->offsets[vertexID];
+		const size_t last  = this->offsets[vertexID + 1];
+		return ArcRange<ArcIterator>(
+			ArcIterator(this->targets.data() + first, this->costs.data() + first),
+			ArcIterator(this->targets.data() + last, this->costs.data() + last)
+		);
+	}
+
+	template<typename N>
+	size_t CsrGraph<N>::getVertexCount() const
+	{
+		return this->vertexCount;
+	}
+
+	template<typename N>
+	size_t CsrGraph<N>::getEdgeCount() const
+	{
+		return this->targets.size();
+	}
+
+	template<typename N>
+	vid_t CsrGraph<N>::getIdBound() const
+	{
+		return static_cast<vid_t>(this->present.size());
+	}
+
+	template<typename N>
+	bool CsrGraph<N>::vertexExists(const vid_t & vertexID) const
+	{
+		return vertexID < this->present.size() && this->present[vertexID];
+	}
+
+	template<typename N>
+	void CsrGraph<N>::addVertex(const vid_t & vertexID)
+	{
+		if (this->built)
+		{
+			throw std::logic_error("Graph is already built.");
+		}
+
+		if (this->vertexExists(vertexID))
+		{
+			throw std::logic_error("Vertex alredy in graph.");
+		}
+
+		if (vertexID >= this->present.size())
+		{
+			this->present.resize(vertexID + 1, false);
+		}
+
+		this->present[vertexID] = true;
+		++this->vertexCount;
+	}
+
+	template<typename N>
+	void CsrGraph<N>::addEdgeBi(const vid_t & vid1, const vid_t & vid2, const N & cost)
+	{
+		this->checkEdgeEnds(vid1, vid2);
+		this->pending.push_back(PendingEdge{ vid1, vid2, cost, true });
+		this->maxArcCost = std::max(this->maxArcCost, cost);
+	}
+
+	template<typename N>
+	void CsrGraph<N>::addEdgeOriented(const vid_t & vidSrc, const vid_t & vidDst, const N & cost)
+	{
+		this->checkEdgeEnds(vidSrc, vidDst);
+		this->pending.push_back(PendingEdge{ vidSrc, vidDst, cost, false });
+		this->maxArcCost = std::max(this->maxArcCost, cost);
+	}
+
+	template<typename N>
+	void CsrGraph<N>::build()
+	{
+		if (this->built)
+		{
+			throw std::logic_error("Graph is already built.");
+		}
+
+		const size_t idBound = this->present.size();
+
+		// offsets[v + 1] najprv pota vstupn stupe v, prefixov set z neho sprav zaiatky sekov
+		this->offsets.assign(idBound + 1, 0);
+		for (const PendingEdge & edge : this->pending)
+		{
+			++this->offsets[edge.src + 1];
+			if (edge.bidirectional) ++this->offsets[edge.dst + 1];
+		}
+
+		for (size_t i = 1; i <= idBound; i++)
+		{
+			this->offsets[i] += this->offsets[i - 1];
+		}
+
+		this->targets.resize(this->offsets[idBound]);
+		this->costs.resize(this->offsets[idBound]);
+
+		std::vector<size_t> fill(this->offsets.begin(), this->offsets.end() - 1);
+		for (const PendingEdge & edge : this->pending)
+		{
+			this->targets[fill[edge.src]] = edge.dst;
+			this->costs[fill[edge.src]++] = edge.cost;
+
+			if (edge.bidirectional)
+			{
+				this->targets[fill[edge.dst]] = edge.src;
+				this->costs[fill[edge.dst]++] = edge.cost;
+			}
+		}
+
+		std::vector<PendingEdge>().swap(this->pending);
+		this->built = true;
+	}
+
+	template<typename N>
+	void CsrGraph<N>::checkEdgeEnds(const vid_t & vid1, const vid_t & vid2)
+	{
+		if (this->built)
+		{
+			throw std::logic_error("Graph is already built.");
+		}
+
+		if (!this->vertexExists(vid1) || !this->vertexExists(vid2))
+		{
+			throw std::logic_error("No such vertex.");
+		}
+	}
+
+	//
+	// ArcIterator
+	//
+	template<typename N>
+	CsrGraph<N>::ArcIterator::ArcIterator(const vid_t * pTarget, const N * pCost) :
+		target(pTarget),
+		cost(pCost)
+	{
+	}
+
+	template<typename N>
+	bool CsrGraph<N>::ArcIterator::operator!=(const ArcIterator & other) const
+	{
+		return this->target != other.target;
+	}
+
+	template<typename N>
+	Arc<N> CsrGraph<N>::ArcIterator::operator*() const
+	{
+		return Arc<N>(*this->target, *this->cost);
+	}
+
+	template<typename N>
+	auto CsrGraph<N>::ArcIterator::operator++() -> ArcIterator &
+	{
+		++this->target;
+		++this->cost;
+		return *this;
+	}
+
+}
\ No newline at end of file
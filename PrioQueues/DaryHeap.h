@@ -0,0 +1,363 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+
+#include "PriorityQueue.h"
+#include "AlignedAllocator.h"
+#include "BitOps.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(log_D n)
+		findMin		-> O(1)
+		decreaseKey	-> O(log_D n)
+		meld		-> O(n + m)
+		deleteMin	-> O(D log_D n)
+
+		< Template parameters >
+
+		D     -> arity of the heap.
+		Order -> ordering policy (MinOrder, MaxOrder).
+
+		Implicit D-ary heap. Unlike BinaryHeap the array stores (priority, item) pairs
+		inline, so comparisons during sifting never dereference an item. Items hold
+		the element and their position in the array, which is what decreaseKey uses.
+		The array is aligned to the cache line and shifted by D - 1 slots so that
+		all children of a node start at a cache line boundary. With 16 byte slots
+		(8 byte priority + pointer) the children of a node of a 4-ary heap fill
+		exactly one cache line, for D = 8 and 16 they fill two and four adjacent lines.
+	*/
+	template<typename N, typename E, int D = 4, typename Order = MinOrder<N>>
+	class DaryHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class DaryHeapItem;
+
+		struct DarySlot
+		{
+			N prio;
+			DaryHeapItem * item;
+		};
+
+		static const size_t Offset = D - 1;
+
+	private:
+
+		std::vector<DarySlot, AlignedAllocator<DarySlot, 64>> slots;
+
+	public:
+
+		typedef DaryHeapItem entry_t;
+
+		explicit DaryHeap(size_t initCapacity = 64);
+		virtual ~DaryHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+		void reserve(size_t n)                                  override;
+
+	private:
+
+		DarySlot & at(size_t index);
+		void place(size_t index, const DarySlot & slot);
+		void siftUp(size_t index);
+		void siftDown(size_t index);
+		void heapify();
+
+	private:
+
+		class DaryHeapItem : public QueueEntry<N, E>
+		{
+		public:
+
+			size_t index;
+
+			DaryHeapItem(E pData, N pPrio, size_t pIndex);
+			~DaryHeapItem() = default;
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	//
+	// DaryHeapItem
+	//
+	template<typename N, typename E, int D, typename Order>
+	DaryHeap<N, E, D, Order>::DaryHeapItem::DaryHeapItem(E pData, N pPrio, size_t pIndex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		index(pIndex)
+	{
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::DaryHeapItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	//
+	// DaryHeap
+	//
+	template<typename N, typename E, int D, typename Order>
+	DaryHeap<N, E, D, Order>::DaryHeap(size_t initCapacity)
+	{
+		static_assert(D >= 2, "Arity of the heap must be at least 2.");
+
+		this->slots.reserve(Offset + initCapacity);
+		this->slots.resize(Offset);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	DaryHeap<N, E, D, Order>::~DaryHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	QueueEntry<N, E> * DaryHeap<N, E, D, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	QueueEntry<N, E> * DaryHeap<N, E, D, Order>::insert(E && data, N prio)
+	{
+		const size_t index = this->size();
+
+		auto * newItem = new DaryHeapItem(std::move(data), prio, index);
+		this->slots.push_back(DarySlot{ prio, newItem });
+		this->siftUp(index);
+
+		return newItem;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt DaryHeap<N, E, D, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		const size_t oldSize = this->size();
+
+		for (; first != last; ++first)
+		{
+			auto * newItem = new DaryHeapItem(first->first, first->second, this->size());
+			this->slots.push_back(DarySlot{ first->second, newItem });
+			*out++ = newItem;
+		}
+
+		const size_t newCount = this->size() - oldSize;
+
+		// same rule as in BinaryHeap: sifting up costs up to log n per new item, heapify n for the whole array
+		if (newCount != 0 && newCount * BitOps::highestSetBit(this->size()) >= this->size())
+		{
+			this->heapify();
+		}
+		else
+		{
+			for (size_t i = oldSize; i < this->size(); i++)
+			{
+				this->siftUp(i);
+			}
+		}
+
+		return out;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(item, newPrio);
+
+		item.setPrio(newPrio);
+		this->at(item.index).prio = newPrio;
+		this->siftUp(item.index);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	PriorityQueue<N, E> * DaryHeap<N, E, D, Order>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherDary = dynamic_cast<DaryHeap<N, E, D, Order> *>(other);
+
+		if (!otherDary)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		this->slots.insert(this->slots.end(), otherDary->slots.begin() + Offset, otherDary->slots.end());
+		otherDary->slots.resize(Offset);
+
+		const size_t count = this->size();
+		for (size_t i = count; i > 0; i--)
+		{
+			this->at(i - 1).item->index = i - 1;
+		}
+
+		this->heapify();
+
+		return this;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	std::pair<E, N> DaryHeap<N, E, D, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		DaryHeapItem * poped = this->at(0).item;
+		const DarySlot last = this->slots.back();
+		this->slots.pop_back();
+
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		if (!this->isEmpty())
+		{
+			this->place(0, last);
+			this->siftDown(0);
+		}
+
+		return popedData;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	E DaryHeap<N, E, D, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	E & DaryHeap<N, E, D, Order>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->at(0).item->getData();
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	size_t DaryHeap<N, E, D, Order>::size()
+	{
+		return this->slots.size() - Offset;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::clear()
+	{
+		for (size_t i = Offset; i < this->slots.size(); i++)
+		{
+			delete this->slots[i].item;
+		}
+
+		this->slots.resize(Offset);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::reserve(const size_t n)
+	{
+		this->slots.reserve(Offset + n);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	auto DaryHeap<N, E, D, Order>::at(const size_t index) -> DarySlot &
+	{
+		return this->slots[index + Offset];
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::place(const size_t index, const DarySlot & slot)
+	{
+		this->at(index) = slot;
+		slot.item->index = index;
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::siftUp(size_t index)
+	{
+		const DarySlot moved = this->at(index);
+
+		while (index > 0)
+		{
+			const size_t parentIndex = (index - 1) / D;
+			const DarySlot & parent = this->at(parentIndex);
+
+			if (!Order::before(moved.prio, parent.prio)) break;
+
+			this->place(index, parent);
+			index = parentIndex;
+		}
+
+		this->place(index, moved);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::siftDown(size_t index)
+	{
+		const DarySlot moved = this->at(index);
+		const size_t count = this->size();
+
+		for (;;)
+		{
+			const size_t firstChild = index * D + 1;
+
+			if (firstChild >= count) break;
+
+			const size_t lastChild = firstChild + D < count ? firstChild + D : count;
+			size_t minChild = firstChild;
+			for (size_t child = firstChild + 1; child < lastChild; child++)
+			{
+				if (Order::before(this->at(child).prio, this->at(minChild).prio))
+				{
+					minChild = child;
+				}
+			}
+
+			if (!Order::before(this->at(minChild).prio, moved.prio)) break;
+
+			this->place(index, this->at(minChild));
+			index = minChild;
+		}
+
+		this->place(index, moved);
+	}
+
+	template<typename N, typename E, int D, typename Order>
+	void DaryHeap<N, E, D, Order>::heapify()
+	{
+		// bottom-up, leaves are already heaps
+		const size_t count = this->size();
+
+		if (count > 1)
+		{
+			for (size_t i = (count - 2) / D + 1; i > 0; i--)
+			{
+				this->siftDown(i - 1);
+			}
+		}
+	}
+
+}
\ No newline at end of file
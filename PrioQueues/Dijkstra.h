@@ -1,6 +1,19 @@
 #pragma once
 
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <type_traits>
+
 #include "Stopwatch.h"
+#include "RNG.h"
+#include "AutoQueue.h"
+#include "Graph.h"
+#include "CsrGraph.h"
 #include  "vid_t.h"
 
 namespace uniza_fri {
@@ -29,28 +42,66 @@ namespace uniza_fri {
 	};
 
 	/*
-		Tto trieda obauje dta potrebn pre implementciu Dijkstrovho algoritmu.
-		Jej intancie sa vkladaj do vrcholov grafu.
+		Stav jednho hadania - doasn znaky vrcholov a ukazovatele na ich
+		poloky v prioritnom fronte. Obe polia s indexovan identifiktorom vrcholu,
+		take graf pri hadan zostva nezmenen a nad jednm natanm grafom
+		me sasne bea viac hadan, kad s vlastnm kontextom.
+
+		Kontext sa pred hadanm nenuluje prechodom cez vetky vrcholy. Kad znaka
+		si pamt slo hadania (epochu), v ktorom bola zapsan. Znaka zo starej
+		epochy sa ta ako maxDist a poloka ako nullptr, take reset je O(1)
+		a krtke hadanie stoj as mern iba prehadanej asti grafu.
 
 		N -> dtov typ, v ktorom s ohodnotenia hrn grafu.
 	 */
 	template<typename N>
-	class DijkstraData
+	class DijkstraContext
 	{
 	private:
 
-		N markT;
-		QueueEntry<N, Vertex<N, DijkstraData<N>>*> * entry;
+		typedef unsigned int epoch_t;
+
+		/*
+			Znaka vrcholu spolu s epochou, v ktorej bola zapsan.
+			S veda seba, aby kontrola aj tanie znaky boli jeden prstup do pamte.
+			heapIndex je pozcia vrcholu v intrzivnom fronte, zmest sa do vplne za epochou.
+		 */
+		struct Label
+		{
+			N markT;
+			epoch_t epoch;
+			vid_t heapIndex;
+		};
+
+	private:
+
+		std::vector<Label> labels;
+		std::vector<QueueEntry<N, vid_t> *> entries;
+		epoch_t currentEpoch;
+		N maxDist;
 
 	public:
 
-		DijkstraData();
-		~DijkstraData() = default;
+		/*
+			heapIndex vrcholu, ktor nie je v intrzivnom fronte.
+		 */
+		static const vid_t NotInHeap = static_cast<vid_t>(-1);
+
+		explicit DijkstraContext(vid_t idBound);
+		~DijkstraContext() = default;
+
+		void reset(N pMaxDist);
+
+		N getT(vid_t vertexID) const;
+		void setT(vid_t vertexID, N t);
+		QueueEntry<N, vid_t> * getEntry(vid_t vertexID) const;
+		void setEntry(vid_t vertexID, QueueEntry<N, vid_t> * e);
+		vid_t getHeapIndex(vid_t vertexID) const;
+		void setHeapIndex(vid_t vertexID, vid_t index);
+
+	private:
 
-		N getT();
-		N setT(N t);
-		QueueEntry<N, Vertex<N, DijkstraData<N>>*> * getEntry();
-		void setEntry(QueueEntry<N, Vertex<N, DijkstraData<N>>*> * e);
+		Label & stampedLabel(vid_t vertexID);
 
 	};
 
@@ -58,26 +109,71 @@ namespace uniza_fri {
 		Tto trieda implementuje Dijkstrov algoritmus.
 		Poskytuje dve jeho implementcie, a to zkladn verziu popsan
 		v knihe Introduction to algorithms a verziu zvan Label-set algoritmus.
+
+		Prioritn front sa vytvra ako loklna premenn konkrtneho typu
+		(Factory<prio_queue_t>::queue_t), nie cez virtulne rozhranie PriorityQueue.
+		Poloky z kontextu sa na typ poloky frontu pretypuj cez static_cast,
+		take cel relaxcia hrn sa d skompilova bez virtulnych volan.
+
+		N -> dtov typ, v ktorom s ohodnotenia hrn grafu.
+		graph_t -> graf, v ktorom sa had (CsrGraph alebo Graph). Hadanie ho iba ta,
+				   vrcholy sa v prioritnom fronte identifikuj pomocou vid_t
+				   a hrany sa prechdzaj cez forwardStar, ktor vracia Arc.
 	 */
-	template<typename N>
+	template<typename N, typename graph_t = CsrGraph<N>>
 	class Dijkstra
 	{
 	private:
 
-		typedef Vertex<N, DijkstraData<N>> vertex_t;
-		typedef Edge<N, DijkstraData<N>>     edge_t;
+		/*
+			Obal frontu uloenho v Dijkstra::queues. Fronty nemaj spolonho predka
+			(intrzivne nie s PriorityQueue), obal im dva virtulny detruktor.
+		 */
+		struct StoredQueue
+		{
+			virtual ~StoredQueue() = default;
+		};
+
+		template<typename queue_t>
+		struct StoredQueueOf : StoredQueue
+		{
+			queue_t queue;
+
+			template<typename... Args>
+			explicit StoredQueueOf(Args &&... args) : queue(std::forward<Args>(args)...) {}
+		};
+
+	private:
+
+		const graph_t * graph;
+		DijkstraContext<N> context;
+
+		/*
+			Fronty, ktor si hadania nechvaj medzi dopytmi, jeden pre kad typ frontu.
+			Pred alm hadanm sa iba vyprzdnia (clear), take si ponechaj
+			alokovan kapacitu pol aj uvonen uzly v pooloch.
+		 */
+		std::unordered_map<std::type_index, std::unique_ptr<StoredQueue>> queues;
 
-		Graph<N, DijkstraData<N>> * graph;
+		/*
+			Index frontu (viz. AutoQueue), ktor sa pouije pre auto_queue.
+		 */
+		int autoQueue;
 
 	public:
 
-		explicit Dijkstra(Graph<N, DijkstraData<N>> * pGraph);
+		explicit Dijkstra(const graph_t * pGraph);
 		virtual ~Dijkstra() = default;
 
 		/*
 			Njde najkratiu cestu medzi danmi vrcholmi. 
 			Implementuje Label-set algoritmus. V prioritnom fronte je teda
 			na zaiatku iba jeden vrchol.
+			Ak front nevie zni k (has_decrease_key), pouije sa leniv mazanie:
+			vrchol s novou znakou sa do frontu vlo znova a zastaran kpie
+			sa pri vbere z frontu preskoia. Intrzivny front (is_intrusive_queue)
+			si pozcie vrcholov uklad do kontextu ako v pointToAllLabelSet.
+			Pre auto_queue sa pouije front vybran rovnako ako v pointToAllLabelSet.
 		 */
 		template<typename prio_queue_t>
 		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst);
@@ -86,6 +182,9 @@ namespace uniza_fri {
 			Njde najkratie cesty z danho vrcholu do vetkch vrcholov.
 			Implementuje Label-set algoritmus. V prioritnom fronte je teda
 			na zaiatku iba jeden vrchol.
+			Fronty bez decreaseKey pouvaj leniv mazanie ako pointToPointSearch.
+			Pre auto_queue sa pri prvom hadan front vyberie poda profilu, a ak v om
+			graf ete nie je, krtkou kalibrciou (viz. trieda AutoQueue).
 		 */
 		template<typename prio_queue_t>
 		PathInfo<N> * pointToAllLabelSet(vid_t idSrc);
@@ -93,14 +192,77 @@ namespace uniza_fri {
 		/*
 			Njde najkratie cesty z danho vrcholu do vetkch vrcholov.
 			Implementuje zkladn verziu Dijkstrovho algoritmu. Pred zaiatkom
-			prehadvania grafu sa do prioritnho frontu vloia vetky vrcholy.
+			prehadvania grafu sa do prioritnho frontu vloia vetky vrcholy,
+			a to naraz cez insertMany, ktor vina frontov zvldne rchlejie
+			ako postupn vkladanie. Front mus vedie zni k, mus poskytova
+			Factory<T>::queue_t (intrzivny front nie) a nesmie ma ohranien rozsah
+			kov (has_bounded_span), pretoe vrcholy maj na zaiatku nekonen vzdialenos.
+			auto_queue sa tu poui ned, kalibrcia me vybra aj front, ktor tieto
+			podmienky nespa.
 		 */
 		template<typename prio_queue_t>
 		PathInfo<N> * pointToAllBasic(vid_t idSrc);
 
+		/*
+			Kontext poslednho hadania, obsahuje znaky vetkch vrcholov.
+		 */
+		const DijkstraContext<N> & getContext() const;
+
+		/*
+			Priprav front danho druhu na n prvkov, aby ani prv hadanie
+			nemuselo zvova jeho pam. pointToAllBasic si front priprav sm
+			na poet vrcholov grafu.
+		 */
+		template<typename prio_queue_t>
+		void reserveQueue(size_t n);
+
 	private:
 
 		void init();
+		void checkVertex(vid_t vertexID) const;
+		void calibrateAutoQueue();
+
+		template<typename queue_t, typename... Args>
+		queue_t & getQueue(Args &&... args);
+
+		template<typename prio_queue_t, typename queue_t>
+		queue_t & getQueueFor();
+
+		template<typename queue_t>
+		queue_t & getQueueFor(std::true_type boundedSpan);
+
+		template<typename queue_t>
+		queue_t & getQueueFor(std::false_type boundedSpan);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst, std::true_type autoQueue);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type autoQueue);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type intrusive, std::true_type decreaseKey);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst, std::true_type intrusive, std::true_type decreaseKey);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type intrusive, std::false_type decreaseKey);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToAllLabelSet(vid_t idSrc, std::true_type autoQueue);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToAllLabelSet(vid_t idSrc, std::false_type autoQueue);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToAllLabelSet(vid_t idSrc, std::false_type intrusive, std::true_type decreaseKey);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToAllLabelSet(vid_t idSrc, std::true_type intrusive, std::true_type decreaseKey);
+
+		template<typename prio_queue_t>
+		PathInfo<N> * pointToAllLabelSet(vid_t idSrc, std::false_type intrusive, std::false_type decreaseKey);
 
 	};
 
@@ -134,108 +296,360 @@ namespace uniza_fri {
 	}
 
 	//
-	// DijkstraData
+	// DijkstraContext
 	//
 	template<typename N>
-	DijkstraData<N>::DijkstraData() :
-		entry(nullptr)
+	DijkstraContext<N>::DijkstraContext(const vid_t idBound) :
+		labels(idBound, Label{ N(), 0, NotInHeap }),
+		entries(idBound, nullptr),
+		currentEpoch(0),
+		maxDist()
+	{
+	}
+
+	template<typename N>
+	void DijkstraContext<N>::reset(N pMaxDist)
+	{
+		this->maxDist = pMaxDist;
+		++this->currentEpoch;
+
+		// po preteen by star znaky mohli vyzera ako aktulne, raz za 2^32 hadan sa teda nuluj naozaj
+		if (this->currentEpoch == 0)
+		{
+			std::fill(this->labels.begin(), this->labels.end(), Label{ N(), 0, NotInHeap });
+			this->currentEpoch = 1;
+		}
+	}
+
+	template<typename N>
+	N DijkstraContext<N>::getT(const vid_t vertexID) const
+	{
+		const Label & label = this->labels[vertexID];
+		return label.epoch == this->currentEpoch ? label.markT : this->maxDist;
+	}
+
+	template<typename N>
+	void DijkstraContext<N>::setT(const vid_t vertexID, N t)
 	{
+		this->stampedLabel(vertexID).markT = t;
 	}
 
 	template<typename N>
-	N DijkstraData<N>::getT()
+	QueueEntry<N, vid_t>* DijkstraContext<N>::getEntry(const vid_t vertexID) const
 	{
-		return this->markT;
+		return this->labels[vertexID].epoch == this->currentEpoch ? this->entries[vertexID] : nullptr;
 	}
 
 	template<typename N>
-	N DijkstraData<N>::setT(N t)
+	void DijkstraContext<N>::setEntry(const vid_t vertexID, QueueEntry<N, vid_t>* e)
 	{
-		return this->markT = t;
+		this->stampedLabel(vertexID);
+		this->entries[vertexID] = e;
 	}
 
 	template<typename N>
-	QueueEntry<N, Vertex<N, DijkstraData<N>>*>* DijkstraData<N>::getEntry()
+	vid_t DijkstraContext<N>::getHeapIndex(const vid_t vertexID) const
 	{
-		return this->entry;
+		const Label & label = this->labels[vertexID];
+		return label.epoch == this->currentEpoch ? label.heapIndex : NotInHeap;
 	}
 
 	template<typename N>
-	void DijkstraData<N>::setEntry(QueueEntry<N, Vertex<N, DijkstraData<N>>*>* e)
+	void DijkstraContext<N>::setHeapIndex(const vid_t vertexID, const vid_t index)
 	{
-		this->entry = e;
+		this->stampedLabel(vertexID).heapIndex = index;
+	}
+
+	template<typename N>
+	auto DijkstraContext<N>::stampedLabel(const vid_t vertexID) -> Label &
+	{
+		Label & label = this->labels[vertexID];
+
+		// znaka z niektorho z predolch hadan, vetky daje vrcholu sa vrtia na poiaton hodnoty
+		if (label.epoch != this->currentEpoch)
+		{
+			label.epoch = this->currentEpoch;
+			label.markT = this->maxDist;
+			label.heapIndex = NotInHeap;
+			this->entries[vertexID] = nullptr;
+		}
+
+		return label;
 	}
 
 	//
 	// Dijkstra
 	//
-	template<typename N>
-	Dijkstra<N>::Dijkstra(Graph<N, DijkstraData<N>>* pGraph) :
-		graph(pGraph)
+	template<typename N, typename graph_t>
+	Dijkstra<N, graph_t>::Dijkstra(const graph_t * pGraph) :
+		graph(pGraph),
+		context(pGraph->getIdBound()),
+		autoQueue(AutoQueue::NotCalibrated)
 	{
 	}
 
-	template<typename N>
-	void Dijkstra<N>::init()
+	template<typename N, typename graph_t>
+	const DijkstraContext<N> & Dijkstra<N, graph_t>::getContext() const
+	{
+		return this->context;
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	void Dijkstra<N, graph_t>::reserveQueue(const size_t n)
+	{
+		typedef typename Factory<prio_queue_t>::template queue_t<N, vid_t> queue_t;
+
+		this->template getQueueFor<prio_queue_t, queue_t>().reserve(n);
+	}
+
+	template<typename N, typename graph_t>
+	void Dijkstra<N, graph_t>::init()
+	{
+		this->context.reset(this->graph->getMaxDist());
+	}
+
+	template<typename N, typename graph_t>
+	void Dijkstra<N, graph_t>::checkVertex(const vid_t vertexID) const
 	{
-		for (vertex_t * vertex : *(this->graph))
+		if (!this->graph->vertexExists(vertexID))
 		{
-			vertex->getData()->setT(this->graph->getMaxDist());
-			vertex->getData()->setEntry(nullptr);
+			throw std::logic_error("No such vertex.");
 		}
 	}
 
-	template<typename N>
+	template<typename N, typename graph_t>
+	void Dijkstra<N, graph_t>::calibrateAutoQueue()
+	{
+		this->autoQueue = AutoQueue::loadWinner(this->graph->getName(), this->graph->getVertexCount());
+
+		if (this->autoQueue != AutoQueue::NotCalibrated)
+		{
+			return;
+		}
+
+		// vetky fronty hadaj z rovnakch vrcholov, prv hadanie iba priprav front a nemeria sa
+		RNG randomGenerator(144);
+		std::vector<vid_t> sources;
+		for (int i = 0; i <= AutoQueue::CalibrationQueries; i++)
+		{
+			sources.push_back(static_cast<vid_t>(randomGenerator.nextSizeT(1, this->graph->getVertexCount())));
+		}
+
+		long long bestTime = 0;
+
+		for (int candidate = 0; candidate < AutoQueue::CandidateCount; candidate++)
+		{
+			long long time = 0;
+
+			for (size_t i = 0; i < sources.size(); i++)
+			{
+				PathInfo<N> * info = AutoQueue::dispatch(candidate, [this, &sources, i](auto queueTag)
+				{
+					return this->template pointToAllLabelSet<decltype(queueTag)>(sources[i]);
+				});
+
+				if (i > 0)
+				{
+					time += info->getTimeTaken();
+				}
+
+				delete info;
+			}
+
+			if (this->autoQueue == AutoQueue::NotCalibrated || time < bestTime)
+			{
+				this->autoQueue = candidate;
+				bestTime = time;
+			}
+		}
+
+		AutoQueue::storeWinner(this->graph->getName(), this->graph->getVertexCount(), this->autoQueue);
+	}
+
+	template<typename N, typename graph_t>
+	template<typename queue_t, typename... Args>
+	queue_t & Dijkstra<N, graph_t>::getQueue(Args &&... args)
+	{
+		std::unique_ptr<StoredQueue> & stored = this->queues[std::type_index(typeid(queue_t))];
+
+		if (!stored)
+		{
+			stored.reset(new StoredQueueOf<queue_t>(std::forward<Args>(args)...));
+		}
+
+		// po predolom hadan mu vo fronte zosta vrcholy (napr. po njden ciea)
+		queue_t & queue = static_cast<StoredQueueOf<queue_t> &>(*stored).queue;
+		if (!queue.isEmpty())
+		{
+			queue.clear();
+		}
+
+		return queue;
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t, typename queue_t>
+	queue_t & Dijkstra<N, graph_t>::getQueueFor()
+	{
+		return this->template getQueueFor<queue_t>(has_bounded_span<prio_queue_t>());
+	}
+
+	template<typename N, typename graph_t>
+	template<typename queue_t>
+	queue_t & Dijkstra<N, graph_t>::getQueueFor(std::true_type)
+	{
+		// Dialov front sa vytvor s potom priehradiek poda maximlnej ceny hrany
+		return this->template getQueue<queue_t>(static_cast<size_t>(this->graph->getMaxArcCost()));
+	}
+
+	template<typename N, typename graph_t>
+	template<typename queue_t>
+	queue_t & Dijkstra<N, graph_t>::getQueueFor(std::false_type)
+	{
+		return this->template getQueue<queue_t>();
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst)
+	{
+		return this->template pointToPointSearch<prio_queue_t>(idSrc, idDst, is_auto_queue<prio_queue_t>());
+	}
+
+	template<typename N, typename graph_t>
 	template<typename prio_queue_t>
-	PathInfo<N>* Dijkstra<N>::pointToPointSearch(vid_t idSrc, vid_t idDst)
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst, std::true_type)
 	{
-		vertex_t * src = this->graph->getVertexExcept(idSrc);
-		vertex_t * dst = this->graph->getVertexExcept(idDst);
+		if (this->autoQueue == AutoQueue::NotCalibrated)
+		{
+			this->calibrateAutoQueue();
+		}
+
+		return AutoQueue::dispatch(this->autoQueue, [this, idSrc, idDst](auto queueTag)
+		{
+			return this->template pointToPointSearch<decltype(queueTag)>(idSrc, idDst);
+		});
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type)
+	{
+		return this->template pointToPointSearch<prio_queue_t>(idSrc, idDst, is_intrusive_queue<prio_queue_t>(), has_decrease_key<prio_queue_t>());
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type, std::true_type)
+	{
+		this->checkVertex(idSrc);
+		this->checkVertex(idDst);
 
 		this->init();
 
+		typedef typename Factory<prio_queue_t>::template queue_t<N, vid_t> queue_t;
+		typedef typename queue_t::entry_t entry_t;
+
+		queue_t & queue = this->template getQueueFor<prio_queue_t, queue_t>();
 		Stopwatch stopwatch;
-		PriorityQueue<N, vertex_t*> * queue = Factory<prio_queue_t>::template makeQueue<N, vertex_t *>();
 
-		src->getData()->setT(this->graph->getZeroDist());
-		src->getData()->setEntry(queue->insert(src, this->graph->getZeroDist()));
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		this->context.setEntry(idSrc, queue.insert(idSrc, this->graph->getZeroDist()));
 
 		size_t visited(0);
 
-		while (!queue->isEmpty())
+		while (!queue.isEmpty())
 		{
-			vertex_t * poped = queue->deleteMin();
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
 
-			if (poped == dst) break;
+			if (poped == idDst) break;
 
-			for (edge_t * edge : poped->edges())
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
 			{
-				N newCost = poped->getData()->getT() + edge->cost();
-				vertex_t * target = edge->target(poped);
+				N newCost = popedT + arc.cost;
 
-				if (newCost < target->getData()->getT())
+				if (newCost < this->context.getT(arc.target))
 				{
-					target->getData()->setT(newCost);
-					QueueEntry<N, vertex_t*> * entry = target->getData()->getEntry();
+					this->context.setT(arc.target, newCost);
+					auto * entry = static_cast<entry_t*>(this->context.getEntry(arc.target));
 					if (entry)
 					{
-						queue->decreaseKey(*entry, newCost);
+						queue.decreaseKey(*entry, newCost);
 					}
 					else
 					{
-						target->getData()->setEntry(queue->insert(target, newCost));
+						this->context.setEntry(arc.target, queue.insert(arc.target, newCost));
 						++visited;
 					}
 				}
 			}
 		}
 
-		delete queue;
+		long long timeTaken = stopwatch.getTime();
+		N pathLenght = this->context.getT(idDst);
+
+		if (pathLenght != this->graph->getMaxDist())
+		{
+			return new PathInfo<N>(pathLenght, timeTaken, visited);
+		}
+
+		return nullptr;
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst, std::true_type, std::true_type)
+	{
+		this->checkVertex(idSrc);
+		this->checkVertex(idDst);
+
+		this->init();
+
+		typedef typename Factory<prio_queue_t>::template intrusive_t<N, DijkstraContext<N>> queue_t;
+
+		queue_t & queue = this->template getQueue<queue_t>(&this->context);
+		Stopwatch stopwatch;
+
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		queue.insert(idSrc, this->graph->getZeroDist());
+
+		size_t visited(0);
+
+		while (!queue.isEmpty())
+		{
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
+
+			if (poped == idDst) break;
+
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
+			{
+				N newCost = popedT + arc.cost;
+
+				if (newCost < this->context.getT(arc.target))
+				{
+					this->context.setT(arc.target, newCost);
+					if (queue.contains(arc.target))
+					{
+						queue.decreaseKey(arc.target, newCost);
+					}
+					else
+					{
+						queue.insert(arc.target, newCost);
+						++visited;
+					}
+				}
+			}
+		}
 
 		long long timeTaken = stopwatch.getTime();
-		N pathLenght = dst->getData()->getT();
+		N pathLenght = this->context.getT(idDst);
 
-		if (dst->getData()->getT() != this->graph->getMaxDist())
+		if (pathLenght != this->graph->getMaxDist())
 		{
 			return new PathInfo<N>(pathLenght, timeTaken, visited);
 		}
@@ -243,99 +657,311 @@ namespace uniza_fri {
 		return nullptr;
 	}
 
-	template<typename N>
+	template<typename N, typename graph_t>
 	template<typename prio_queue_t>
-	PathInfo<N>* Dijkstra<N>::pointToAllLabelSet(vid_t idSrc)
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToPointSearch(vid_t idSrc, vid_t idDst, std::false_type, std::false_type)
 	{
-		vertex_t * src = this->graph->getVertexExcept(idSrc);
+		this->checkVertex(idSrc);
+		this->checkVertex(idDst);
 
 		this->init();
 
+		typedef typename Factory<prio_queue_t>::template lazy_t<N> queue_t;
+
+		queue_t & queue = this->template getQueue<queue_t>();
 		Stopwatch stopwatch;
-		PriorityQueue<N, vertex_t*> * queue = Factory<prio_queue_t>::template makeQueue<N, vertex_t *>();
 
-		src->getData()->setT(this->graph->getZeroDist());
-		src->getData()->setEntry(queue->insert(src, this->graph->getZeroDist()));
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		queue.insert(idSrc, this->graph->getZeroDist());
+
+		size_t visited(0);
+
+		while (!queue.isEmpty())
+		{
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
+
+			// vrchol bol medziasom vloen znova s menou znakou
+			if (this->context.getT(poped) < popedT) continue;
+
+			if (poped == idDst) break;
+
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
+			{
+				N newCost = popedT + arc.cost;
+				const N oldCost = this->context.getT(arc.target);
+
+				if (newCost < oldCost)
+				{
+					if (oldCost == this->graph->getMaxDist())
+					{
+						++visited;
+					}
+
+					this->context.setT(arc.target, newCost);
+					queue.insert(arc.target, newCost);
+				}
+			}
+		}
+
+		long long timeTaken = stopwatch.getTime();
+		N pathLenght = this->context.getT(idDst);
+
+		if (pathLenght != this->graph->getMaxDist())
+		{
+			return new PathInfo<N>(pathLenght, timeTaken, visited);
+		}
+
+		return nullptr;
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc)
+	{
+		return this->template pointToAllLabelSet<prio_queue_t>(idSrc, is_auto_queue<prio_queue_t>());
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc, std::true_type)
+	{
+		if (this->autoQueue == AutoQueue::NotCalibrated)
+		{
+			this->calibrateAutoQueue();
+		}
+
+		return AutoQueue::dispatch(this->autoQueue, [this, idSrc](auto queueTag)
+		{
+			return this->template pointToAllLabelSet<decltype(queueTag)>(idSrc);
+		});
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc, std::false_type)
+	{
+		return this->template pointToAllLabelSet<prio_queue_t>(idSrc, is_intrusive_queue<prio_queue_t>(), has_decrease_key<prio_queue_t>());
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc, std::false_type, std::true_type)
+	{
+		this->checkVertex(idSrc);
+
+		this->init();
+
+		typedef typename Factory<prio_queue_t>::template queue_t<N, vid_t> queue_t;
+		typedef typename queue_t::entry_t entry_t;
+
+		queue_t & queue = this->template getQueueFor<prio_queue_t, queue_t>();
+		Stopwatch stopwatch;
+
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		this->context.setEntry(idSrc, queue.insert(idSrc, this->graph->getZeroDist()));
 
 		size_t visited(1);
 
-		while (!queue->isEmpty())
+		while (!queue.isEmpty())
 		{
-			vertex_t * poped = queue->deleteMin();
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
 
-			for (edge_t * edge : poped->edges())
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
 			{
-				N newCost = poped->getData()->getT() + edge->cost();
-				vertex_t * target = edge->target(poped);
+				N newCost = popedT + arc.cost;
 
-				if (newCost < target->getData()->getT())
+				if (newCost < this->context.getT(arc.target))
 				{
-					target->getData()->setT(newCost);
-					QueueEntry<N, vertex_t*> * entry = target->getData()->getEntry();
+					this->context.setT(arc.target, newCost);
+					auto * entry = static_cast<entry_t*>(this->context.getEntry(arc.target));
 					if (entry)
 					{
-						queue->decreaseKey(*entry, newCost);
+						queue.decreaseKey(*entry, newCost);
 					}
 					else
 					{
-						target->getData()->setEntry(queue->insert(target, newCost));
+						this->context.setEntry(arc.target, queue.insert(arc.target, newCost));
 						++visited;
 					}
 				}
 			}
 		}
 
-		delete queue;
 		long long timeTaken = stopwatch.getTime();
 		return new PathInfo<N>(this->graph->getZeroDist(), timeTaken, visited);
 	}
 
-	template<typename N>
+	template<typename N, typename graph_t>
 	template<typename prio_queue_t>
-	PathInfo<N>* Dijkstra<N>::pointToAllBasic(vid_t idSrc)
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc, std::true_type, std::true_type)
 	{
-		vertex_t * src = this->graph->getVertexExcept(idSrc);
+		this->checkVertex(idSrc);
 
 		this->init();
 
+		// pozcie vrcholov vo fronte s priamo v ich znakch v kontexte, vkladanie ni nealokuje
+		typedef typename Factory<prio_queue_t>::template intrusive_t<N, DijkstraContext<N>> queue_t;
+
+		queue_t & queue = this->template getQueue<queue_t>(&this->context);
 		Stopwatch stopwatch;
-		PriorityQueue<N, vertex_t*> * queue = Factory<prio_queue_t>::template makeQueue<N, vertex_t *>();
 
-		for (vertex_t * vertex : *(this->graph))
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		queue.insert(idSrc, this->graph->getZeroDist());
+
+		size_t visited(1);
+
+		while (!queue.isEmpty())
+		{
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
+
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
+			{
+				N newCost = popedT + arc.cost;
+
+				if (newCost < this->context.getT(arc.target))
+				{
+					this->context.setT(arc.target, newCost);
+					if (queue.contains(arc.target))
+					{
+						queue.decreaseKey(arc.target, newCost);
+					}
+					else
+					{
+						queue.insert(arc.target, newCost);
+						++visited;
+					}
+				}
+			}
+		}
+
+		long long timeTaken = stopwatch.getTime();
+		return new PathInfo<N>(this->graph->getZeroDist(), timeTaken, visited);
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllLabelSet(vid_t idSrc, std::false_type, std::false_type)
+	{
+		this->checkVertex(idSrc);
+
+		this->init();
+
+		typedef typename Factory<prio_queue_t>::template lazy_t<N> queue_t;
+
+		queue_t & queue = this->template getQueue<queue_t>();
+		Stopwatch stopwatch;
+
+		this->context.setT(idSrc, this->graph->getZeroDist());
+		queue.insert(idSrc, this->graph->getZeroDist());
+
+		size_t visited(1);
+
+		while (!queue.isEmpty())
+		{
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
+
+			// vrchol bol medziasom vloen znova s menou znakou
+			if (this->context.getT(poped) < popedT) continue;
+
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
+			{
+				N newCost = popedT + arc.cost;
+				const N oldCost = this->context.getT(arc.target);
+
+				if (newCost < oldCost)
+				{
+					if (oldCost == this->graph->getMaxDist())
+					{
+						++visited;
+					}
+
+					this->context.setT(arc.target, newCost);
+					queue.insert(arc.target, newCost);
+				}
+			}
+		}
+
+		long long timeTaken = stopwatch.getTime();
+		return new PathInfo<N>(this->graph->getZeroDist(), timeTaken, visited);
+	}
+
+	template<typename N, typename graph_t>
+	template<typename prio_queue_t>
+	PathInfo<N>* Dijkstra<N, graph_t>::pointToAllBasic(vid_t idSrc)
+	{
+		static_assert(has_decrease_key<prio_queue_t>::value, "Basic Dijkstra needs a queue with decreaseKey.");
+		static_assert(!is_auto_queue<prio_queue_t>::value, "Basic Dijkstra cannot use auto_queue, calibration may pick a queue it does not support.");
+		static_assert(!is_intrusive_queue<prio_queue_t>::value, "Basic Dijkstra needs Factory<T>::queue_t, intrusive queues are supported only by the label-set searches.");
+		static_assert(!has_bounded_span<prio_queue_t>::value, "Basic Dijkstra inserts vertices with infinite distance, a bucket queue cannot hold them.");
+
+		this->checkVertex(idSrc);
+
+		this->init();
+
+		typedef typename Factory<prio_queue_t>::template queue_t<N, vid_t> queue_t;
+		typedef typename queue_t::entry_t entry_t;
+
+		queue_t & queue = this->template getQueue<queue_t>();
+		Stopwatch stopwatch;
+
+		// front sa postav naraz zo vetkch vrcholov, zdroj m rovno nulov vzdialenos
+		std::vector<std::pair<vid_t, N>> items;
+		items.reserve(this->graph->getVertexCount());
+
+		const vid_t idBound = this->graph->getIdBound();
+		for (vid_t id = 0; id < idBound; id++)
+		{
+			if (!this->graph->vertexExists(id)) continue;
+
+			items.emplace_back(id, id == idSrc ? this->graph->getZeroDist() : this->graph->getMaxDist());
+		}
+
+		std::vector<QueueEntry<N, vid_t> *> entries(items.size());
+		queue.reserve(items.size());
+		queue.insertMany(items.begin(), items.end(), entries.begin());
+
+		for (size_t i = 0; i < items.size(); i++)
 		{
-			vertex->getData()->setEntry(queue->insert(vertex, this->graph->getMaxDist()));
+			this->context.setEntry(items[i].first, entries[i]);
 		}
 
-		src->getData()->setT(this->graph->getZeroDist());
-		queue->decreaseKey(*src->getData()->getEntry(), this->graph->getZeroDist());
+		this->context.setT(idSrc, this->graph->getZeroDist());
 
 		size_t visited(1);
 
-		while (!queue->isEmpty())
+		while (!queue.isEmpty())
 		{
-			vertex_t * poped = queue->deleteMin();
+			const std::pair<vid_t, N> minItem = queue.popMin();
+			const vid_t poped = minItem.first;
+			const N popedT = minItem.second;
 
 			if (visited == this->graph->getVertexCount()) break;
 
-			for (edge_t * edge : poped->edges())
+			for (const Arc<N> & arc : this->graph->forwardStar(poped))
 			{
-				N newCost = poped->getData()->getT() + edge->cost();
-				vertex_t * target = edge->target(poped);
+				N newCost = popedT + arc.cost;
 
-				if (newCost < target->getData()->getT())
+				if (newCost < this->context.getT(arc.target))
 				{
-					if (target->getData()->getT() == this->graph->getMaxDist())
+					if (this->context.getT(arc.target) == this->graph->getMaxDist())
 					{
 						++visited;
 					}
 
-					target->getData()->setT(newCost);
-					queue->decreaseKey(*target->getData()->getEntry(), newCost);
+					this->context.setT(arc.target, newCost);
+					queue.decreaseKey(*static_cast<entry_t*>(this->context.getEntry(arc.target)), newCost);
 				}
 			}
 		}
 
-		delete queue;
 		long long timeTaken = stopwatch.getTime();
 		return new PathInfo<N>(this->graph->getZeroDist(), timeTaken, visited);
 	}
@@ -3,13 +3,14 @@
 #include <stdexcept>
 #include <vector>
 #include "PriorityQueue.h"
+#include "NodePool.h"
 
 #define ever ;;
 
 namespace uniza_fri {
 
-	template<typename N, typename E>
-	class FibonacciHeap : public PriorityQueue<N, E>
+	template<typename N, typename E, template<typename> class Alloc = NewAllocator, typename Order = MinOrder<N>>
+	class FibonacciHeap final : public PriorityQueue<N, E>
 	{
 	private:
 
@@ -19,19 +20,30 @@ namespace uniza_fri {
 
 		size_t dataSize;
 		FibHeapNode * maxPrioItem;
+		Alloc<FibHeapNode> nodes;
 
 	public:
 
+		typedef FibHeapNode entry_t;
+
 		FibonacciHeap();
 		virtual ~FibonacciHeap();
 
 		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename... Args>
+		QueueEntry<N, E> * emplace(N prio, Args &&... args);
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
 		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
 		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
 		E & findMin()                                           override;
 		size_t size()                                           override;
 		void clear()                                            override;
+		void reserve(size_t n)                                  override;
 		
 	private:
 
@@ -40,6 +52,7 @@ namespace uniza_fri {
 		void cutChild(FibHeapNode * child);
 		void removeMinItem();
 		void consolidateRoots();
+		void destroyNodes();
 
 	private:
 
@@ -55,14 +68,16 @@ namespace uniza_fri {
 			FibHeapNode * next;
 			FibHeapNode * child;
 
-			FibHeapNode(const E & data, N prio);
+			FibHeapNode(E data, N prio);
+			template<typename... Args>
+			FibHeapNode(emplace_tag tag, N prio, Args &&... args);
 			~FibHeapNode();
 
 			bool isRoot();
 			bool isViolating();
 			FibHeapNode * merge(FibHeapNode * other);
 			FibHeapNode * disconectChildren();
-			void cutChild(FibHeapNode * child, FibonacciHeap<N, E> * heap);
+			void cutChild(FibHeapNode * child, FibonacciHeap<N, E, Alloc, Order> * heap);
 			void addChild(FibHeapNode * newChild);
 			void removeChild(FibHeapNode * child);
 			void removeFromList();
@@ -75,9 +90,9 @@ namespace uniza_fri {
 	//
 	// FibHeapNode
 	//
-	template<typename N, typename E>
-	FibonacciHeap<N, E>::FibHeapNode::FibHeapNode(const E & data, N prio) :
-		QueueEntry<N, E>(data, prio),
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::FibHeapNode(E data, N prio) :
+		QueueEntry<N, E>(std::move(data), prio),
 		rank(0),
 		marked(false),
 		parent(nullptr),
@@ -87,21 +102,22 @@ namespace uniza_fri {
 	{
 	}
 
-	template<typename N, typename E>
-	FibonacciHeap<N, E>::FibHeapNode::~FibHeapNode()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	template<typename... Args>
+	FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::FibHeapNode(emplace_tag tag, N prio, Args &&... args) :
+		QueueEntry<N, E>(tag, prio, std::forward<Args>(args)...),
+		rank(0),
+		marked(false),
+		parent(nullptr),
+		prev(nullptr),
+		next(nullptr),
+		child(nullptr)
 	{
-		if (this->child != nullptr)
-		{
-			FibHeapNode * endIt = this->child;
-			FibHeapNode * iterated = this->child;
-
-			do {
-				FibHeapNode * nextIt = iterated->next;
-				delete iterated;
-				iterated = nextIt;
-			} while (iterated != endIt);
-		}
+	}
 
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::~FibHeapNode()
+	{
 		this->child = nullptr;
 		this->prev = nullptr;
 		this->next = nullptr;
@@ -109,22 +125,22 @@ namespace uniza_fri {
 		this->rank = -1;
 	}
 
-	template<typename N, typename E>
-	bool FibonacciHeap<N, E>::FibHeapNode::isRoot()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	bool FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::isRoot()
 	{
 		return this->parent == nullptr;
 	}
 
-	template<typename N, typename E>
-	bool FibonacciHeap<N, E>::FibHeapNode::isViolating()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	bool FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::isViolating()
 	{
-		return !this->isRoot() && *this < *this->parent;
+		return !this->isRoot() && Order::before(this->getPrio(), this->parent->getPrio());
 	}
 
-	template<typename N, typename E>
-	auto FibonacciHeap<N, E>::FibHeapNode::merge(FibHeapNode * other) -> FibHeapNode *
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	auto FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::merge(FibHeapNode * other) -> FibHeapNode *
 	{
-		if (*this < *other)
+		if (Order::before(this->getPrio(), other->getPrio()))
 		{
 			other->removeFromList();
 			this->addChild(other);
@@ -138,8 +154,8 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	auto FibonacciHeap<N, E>::FibHeapNode::disconectChildren() -> FibHeapNode *
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	auto FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::disconectChildren() -> FibHeapNode *
 	{
 		FibHeapNode * retChild = this->child;
 		if (this->child)
@@ -159,8 +175,8 @@ namespace uniza_fri {
 		return retChild;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::FibHeapNode::cutChild(FibHeapNode * cChild, FibonacciHeap<N, E>* heap)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::cutChild(FibHeapNode * cChild, FibonacciHeap<N, E, Alloc, Order>* heap)
 	{
 		if (cChild == cChild->next)
 		{
@@ -195,8 +211,8 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::FibHeapNode::addChild(FibHeapNode * newChild)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::addChild(FibHeapNode * newChild)
 	{
 		if (this->child == nullptr)
 		{
@@ -216,8 +232,8 @@ namespace uniza_fri {
 		++this->rank;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::FibHeapNode::removeChild(FibHeapNode * child)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::removeChild(FibHeapNode * child)
 	{
 		if (child == child->next)
 		{
@@ -243,15 +259,15 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::FibHeapNode::removeFromList()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::removeFromList()
 	{
 		this->prev->next = this->next;
 		this->next->prev = this->prev;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::FibHeapNode::setPrio(N newPrio)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::FibHeapNode::setPrio(N newPrio)
 	{
 		QueueEntry<N, E>::setPrioInternal(newPrio);
 	}
@@ -259,23 +275,29 @@ namespace uniza_fri {
 	//
 	// FibonacciIHeap
 	//
-	template<typename N, typename E>
-	FibonacciHeap<N, E>::FibonacciHeap() :
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	FibonacciHeap<N, E, Alloc, Order>::FibonacciHeap() :
 		dataSize(0),
 		maxPrioItem(nullptr)
 	{
 	}
 
-	template<typename N, typename E>
-	FibonacciHeap<N, E>::~FibonacciHeap()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	FibonacciHeap<N, E, Alloc, Order>::~FibonacciHeap()
 	{
 		this->clear();
 	}
 
-	template<typename N, typename E>
-	QueueEntry<N, E>* FibonacciHeap<N, E>::insert(const E & data, N prio)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	QueueEntry<N, E>* FibonacciHeap<N, E, Alloc, Order>::insert(const E & data, N prio)
 	{
-		FibHeapNode * newItem = new FibHeapNode(data, prio);
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	QueueEntry<N, E>* FibonacciHeap<N, E, Alloc, Order>::insert(E && data, N prio)
+	{
+		FibHeapNode * newItem = this->nodes.create(std::move(data), prio);
 
 		this->addOneItem(newItem);
 		++this->dataSize;
@@ -283,15 +305,79 @@ namespace uniza_fri {
 		return newItem;
 	}
 
-	template<typename N, typename E>
-	E FibonacciHeap<N, E>::deleteMin()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	template<typename... Args>
+	QueueEntry<N, E>* FibonacciHeap<N, E, Alloc, Order>::emplace(N prio, Args &&... args)
+	{
+		FibHeapNode * newItem = this->nodes.create(emplace_tag(), prio, std::forward<Args>(args)...);
+
+		this->addOneItem(newItem);
+		++this->dataSize;
+
+		return newItem;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt FibonacciHeap<N, E, Alloc, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		if (first == last)
+		{
+			return out;
+		}
+
+		// new nodes form their own root list, which is spliced into the heap at once
+		FibHeapNode * head = this->nodes.create(first->first, first->second);
+		FibHeapNode * tail = head;
+		FibHeapNode * min = head;
+		*out++ = head;
+		++this->dataSize;
+
+		for (++first; first != last; ++first)
+		{
+			FibHeapNode * newItem = this->nodes.create(first->first, first->second);
+			tail->next = newItem;
+			newItem->prev = tail;
+			tail = newItem;
+
+			if (Order::before(newItem->getPrio(), min->getPrio()))
+			{
+				min = newItem;
+			}
+
+			*out++ = newItem;
+			++this->dataSize;
+		}
+
+		tail->next = head;
+		head->prev = tail;
+
+		if (!this->maxPrioItem)
+		{
+			this->maxPrioItem = min;
+		}
+		else
+		{
+			this->addMoreItems(head);
+
+			if (Order::before(min->getPrio(), this->maxPrioItem->getPrio()))
+			{
+				this->maxPrioItem = min;
+			}
+		}
+
+		return out;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	std::pair<E, N> FibonacciHeap<N, E, Alloc, Order>::popMin()
 	{
 		if (this->dataSize == 0)
 		{
 			throw std::out_of_range("Priority queue is empty.");
 		}
 
-		E retData = this->maxPrioItem->getData();
+		std::pair<E, N> retData(std::move(this->maxPrioItem->getData()), this->maxPrioItem->getPrio());
 		--this->dataSize;
 
 		this->removeMinItem();
@@ -304,8 +390,14 @@ namespace uniza_fri {
 		return retData;
 	}
 
-	template<typename N, typename E>
-	E & FibonacciHeap<N, E>::findMin()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	E FibonacciHeap<N, E, Alloc, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	E & FibonacciHeap<N, E, Alloc, Order>::findMin()
 	{
 		if (this->dataSize == 0)
 		{
@@ -315,34 +407,40 @@ namespace uniza_fri {
 		return this->maxPrioItem->getData();
 	}
 
-	template<typename N, typename E>
-	size_t FibonacciHeap<N, E>::size()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	size_t FibonacciHeap<N, E, Alloc, Order>::size()
 	{
 		return this->dataSize;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
 	{
-		PriorityQueue<N, E>::decKeyLogicCheck(entry, newPrio);
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::decreaseKey(entry_t & entry, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(entry, newPrio);
 
-		FibHeapNode * node = &dynamic_cast<FibHeapNode&>(entry);
+		FibHeapNode * node = &entry;
 		node->setPrio(newPrio);
 
 		if (node->isViolating()) 
 		{
 			this->cutChild(node);
 		}
-		else if (*node < *this->maxPrioItem) 
+		else if (Order::before(node->getPrio(), this->maxPrioItem->getPrio())) 
 		{
 			this->maxPrioItem = node;
 		}
 	}
 	
-	template<typename N, typename E>
-	PriorityQueue<N, E>* FibonacciHeap<N, E>::meld(PriorityQueue<N, E>* other)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	PriorityQueue<N, E>* FibonacciHeap<N, E, Alloc, Order>::meld(PriorityQueue<N, E>* other)
 	{
-		FibonacciHeap<N, E> * otherFib = dynamic_cast<FibonacciHeap<N, E> *>(other);
+		FibonacciHeap<N, E, Alloc, Order> * otherFib = dynamic_cast<FibonacciHeap<N, E, Alloc, Order> *>(other);
 
 		if (!otherFib)
 		{
@@ -352,39 +450,56 @@ namespace uniza_fri {
 		{
 			return other;
 		}
+		else if (otherFib->isEmpty())
+		{
+			return this;
+		}
 
+		FibHeapNode * otherMin = otherFib->maxPrioItem;
 		this->dataSize += otherFib->dataSize;
-		this->addMoreItems(otherFib->maxPrioItem);
-		
+		this->addMoreItems(otherMin);
+		this->nodes.absorb(otherFib->nodes);
+
+		if (Order::before(otherMin->getPrio(), this->maxPrioItem->getPrio()))
+		{
+			this->maxPrioItem = otherMin;
+		}
+
 		otherFib->dataSize = 0;
 		otherFib->maxPrioItem = nullptr;
 
 		return this;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::clear()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::clear()
 	{
 		if (!this->maxPrioItem)
 		{
 			return;
 		}
-		
-		this->maxPrioItem->prev->next = nullptr;
-		FibHeapNode * it = this->maxPrioItem;
 
-		while (it)
+		if (canReleaseAll<Alloc<FibHeapNode>, N, E>())
+		{
+			this->nodes.releaseAll();
+		}
+		else
 		{
-			FibHeapNode * nextIter = it->next;
-			delete it;
-			it = nextIter;
+			this->destroyNodes();
 		}
 
 		this->maxPrioItem = nullptr;
+		this->dataSize = 0;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::addOneItem(FibHeapNode * newItem)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::reserve(const size_t n)
+	{
+		this->nodes.reserve(n);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::addOneItem(FibHeapNode * newItem)
 	{
 		if (!this->maxPrioItem)
 		{
@@ -400,14 +515,14 @@ namespace uniza_fri {
 			this->maxPrioItem->next = newItem;
 		}
 
-		if (*newItem < *this->maxPrioItem)
+		if (Order::before(newItem->getPrio(), this->maxPrioItem->getPrio()))
 		{
 			this->maxPrioItem = newItem;
 		}
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::addMoreItems(FibHeapNode * item)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::addMoreItems(FibHeapNode * item)
 	{
 		FibHeapNode * leftLeft = this->maxPrioItem;
 		FibHeapNode * rightRight = this->maxPrioItem->next;
@@ -422,8 +537,8 @@ namespace uniza_fri {
 		rightRight->prev = rightLeft;
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::cutChild(FibHeapNode * child)
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::cutChild(FibHeapNode * child)
 	{
 		FibHeapNode * parent = child->parent;
 		const bool goUp = parent->marked;
@@ -438,14 +553,14 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::removeMinItem()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::removeMinItem()
 	{
 		FibHeapNode * children = this->maxPrioItem->disconectChildren();
 
 		if (this->maxPrioItem == this->maxPrioItem->next)
 		{
-			delete this->maxPrioItem;
+			this->nodes.destroy(this->maxPrioItem);
 			this->maxPrioItem = children;
 		}
 		else
@@ -454,7 +569,7 @@ namespace uniza_fri {
 			
 			this->maxPrioItem->removeFromList();
 			this->maxPrioItem = this->maxPrioItem->next;
-			delete oldMaxPrio;
+			this->nodes.destroy(oldMaxPrio);
 
 			if (children)
 			{
@@ -463,8 +578,8 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	void FibonacciHeap<N, E>::consolidateRoots()
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::consolidateRoots()
 	{
 		int maxRank = static_cast<int>(ceil(log(this->dataSize) / log(1.61))) + 1;
 
@@ -512,11 +627,40 @@ namespace uniza_fri {
 			{
 				this->maxPrioItem = itm;
 			}
-			else if (*itm < *this->maxPrioItem)
+			else if (Order::before(itm->getPrio(), this->maxPrioItem->getPrio()))
 			{
 				this->maxPrioItem = itm;
 			}
 		}
 	}
 
-}
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void FibonacciHeap<N, E, Alloc, Order>::destroyNodes()
+	{
+		// nodes do not delete their children, the whole forest is walked here
+		std::vector<FibHeapNode*> stack;
+		stack.push_back(this->maxPrioItem);
+		this->maxPrioItem->prev->next = nullptr;
+
+		while (!stack.empty())
+		{
+			FibHeapNode * it = stack.back();
+			stack.pop_back();
+
+			while (it)
+			{
+				FibHeapNode * nextIt = it->next;
+
+				if (it->child)
+				{
+					it->child->prev->next = nullptr;
+					stack.push_back(it->child);
+				}
+
+				this->nodes.destroy(it);
+				it = nextIt;
+			}
+		}
+	}
+
+}
\ No newline at end of file
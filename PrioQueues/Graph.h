@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 
 #include "PrioQueueFactory.h"
@@ -11,6 +12,39 @@ namespace uniza_fri {
 	template<typename N, typename vertex_data_t>
 	class Edge;
 
+	/*
+		Hrana tak, ako ju vid prehadvanie grafu - identifiktor cieovho
+		vrcholu a ohodnotenie. Vracaj ju itertory doprednej hviezdy.
+	 */
+	template<typename N>
+	struct Arc
+	{
+		vid_t target;
+		N cost;
+
+		Arc(vid_t pTarget, const N & pCost);
+	};
+
+	/*
+		Dvojica itertorov ohraniujca dopredn hviezdu vrcholu,
+		aby sa dala prechdza cyklom for.
+	 */
+	template<typename iterator_t>
+	class ArcRange
+	{
+	private:
+
+		iterator_t first;
+		iterator_t last;
+
+	public:
+
+		ArcRange(iterator_t pFirst, iterator_t pLast);
+		iterator_t begin() const;
+		iterator_t end() const;
+
+	};
+
 	/*
 		Vrchol grafu. Vlastn dta, ktor sa do neho vloia pri vytoren.
 		M uniktny identifiktor a zoznam hrn, ktor tvoria jeho dopredn hviezdu.
@@ -126,11 +160,32 @@ namespace uniza_fri {
 
 		};
 
+		/*
+			Itertor doprednej hviezdy vrcholu. Cie hrany vracia ako identifiktor,
+			rovnako ako CsrGraph, aby nad oboma grafmi mohol bea ten ist Dijkstra.
+		 */
+		class ArcIterator
+		{
+		private:
+
+			typename std::vector<Edge<N, vertex_data_t> *>::const_iterator it;
+			Vertex<N, vertex_data_t> * src;
+
+		public:
+
+			ArcIterator(typename std::vector<Edge<N, vertex_data_t> *>::const_iterator pIt, Vertex<N, vertex_data_t> * pSrc);
+			bool operator!=(const ArcIterator & other) const;
+			Arc<N> operator*() const;
+			ArcIterator & operator++();
+
+		};
+
 	private:
 
 		std::string name;
 		N zeroDist;
 		N maxDist;
+		N maxArcCost;
 		std::vector<Vertex<N, vertex_data_t> *> vertices;
 		size_t vertexCount;
 
@@ -141,10 +196,14 @@ namespace uniza_fri {
 
 		const std::string & getName() const;
 
-		N getZeroDist();
-		N getMaxDist();
+		N getZeroDist() const;
+		N getMaxDist() const;
+		N getMaxArcCost() const;
 		Vertex<N, vertex_data_t> * getVertexExcept(const vid_t & vertexID);
+		ArcRange<ArcIterator> forwardStar(const vid_t & vertexID) const;
 		size_t getVertexCount() const;
+		vid_t getIdBound() const;
+		bool vertexExists(const vid_t & vertexID) const;
 
 		void addVertex(const vid_t & vertexID);
 		void addEdgeBi(const vid_t & vid1, const vid_t & vid2, const N & cost);
@@ -155,11 +214,39 @@ namespace uniza_fri {
 		typename Graph<N, vertex_data_t>::GraphIterator begin();
 		typename Graph<N, vertex_data_t>::GraphIterator end();
 
-	private:
+	};
 
-		bool vertexExists(const vid_t & vertexID);
+	//
+	// Arc
+	//
+	template<typename N>
+	Arc<N>::Arc(const vid_t pTarget, const N & pCost) :
+		target(pTarget),
+		cost(pCost)
+	{
+	}
 
-	};
+	//
+	// ArcRange
+	//
+	template<typename iterator_t>
+	ArcRange<iterator_t>::ArcRange(iterator_t pFirst, iterator_t pLast) :
+		first(pFirst),
+		last(pLast)
+	{
+	}
+
+	template<typename iterator_t>
+	iterator_t ArcRange<iterator_t>::begin() const
+	{
+		return this->first;
+	}
+
+	template<typename iterator_t>
+	iterator_t ArcRange<iterator_t>::end() const
+	{
+		return this->last;
+	}
 	
 	//
 	// Graph
@@ -169,6 +256,7 @@ namespace uniza_fri {
 		name(std::move(pname)),
 		zeroDist(zeroDistance),
 		maxDist(maxDistance),
+		maxArcCost(zeroDistance),
 		vertexCount(0)
 	{
 		this->vertices.resize(maxVertexCount, nullptr);
@@ -190,17 +278,23 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename vertex_data_t>
-	N Graph<N, vertex_data_t>::getZeroDist()
+	N Graph<N, vertex_data_t>::getZeroDist() const
 	{
 		return this->zeroDist;
 	}
 
 	template<typename N, typename vertex_data_t>
-	N Graph<N, vertex_data_t>::getMaxDist()
+	N Graph<N, vertex_data_t>::getMaxDist() const
 	{
 		return this->maxDist;
 	}
 
+	template<typename N, typename vertex_data_t>
+	N Graph<N, vertex_data_t>::getMaxArcCost() const
+	{
+		return this->maxArcCost;
+	}
+
 	template<typename N, typename vertex_data_t>
 	void Graph<N, vertex_data_t>::addVertex(const vid_t & vertexID)
 	{
@@ -227,6 +321,7 @@ namespace uniza_fri {
 		Edge<N, vertex_data_t> * edge = new EdgeBi<N, vertex_data_t>(v1, v2, cost);
 		v1->addEdge(edge);
 		v2->addEdge(edge);
+		this->maxArcCost = std::max(this->maxArcCost, cost);
 	}
 
 	template<typename N, typename vertex_data_t>
@@ -236,6 +331,7 @@ namespace uniza_fri {
 		Vertex<N, vertex_data_t> * dst = this->getVertexExcept(vidDst);
 		Edge<N, vertex_data_t> * edge = new EdgeOriented<N, vertex_data_t>(dst, cost);
 		src->addEdge(edge);
+		this->maxArcCost = std::max(this->maxArcCost, cost);
 	}
 
 	template<typename N, typename vertex_data_t>
@@ -264,7 +360,7 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename vertex_data_t>
-	bool Graph<N, vertex_data_t>::vertexExists(const vid_t & vertexID)
+	bool Graph<N, vertex_data_t>::vertexExists(const vid_t & vertexID) const
 	{
 		return vertexID < this->vertices.size() && this->vertices[vertexID];
 	}
@@ -280,12 +376,26 @@ namespace uniza_fri {
 		return this->vertices[vertexID];
 	}
 
+	template<typename N, typename vertex_data_t>
+	auto Graph<N, vertex_data_t>::forwardStar(const vid_t & vertexID) const -> ArcRange<ArcIterator>
+	{
+		Vertex<N, vertex_data_t> * src = this->vertices[vertexID];
+		const std::vector<Edge<N, vertex_data_t> *> & edges = src->edges();
+		return ArcRange<ArcIterator>(ArcIterator(edges.begin(), src), ArcIterator(edges.end(), src));
+	}
+
 	template<typename N, typename vertex_data_t>
 	size_t Graph<N, vertex_data_t>::getVertexCount() const
 	{
 		return this->vertexCount;
 	}
 
+	template<typename N, typename vertex_data_t>
+	vid_t Graph<N, vertex_data_t>::getIdBound() const
+	{
+		return static_cast<vid_t>(this->vertices.size());
+	}
+
 	//
 	// Edge
 	//
@@ -439,4 +549,34 @@ namespace uniza_fri {
 		return *this;
 	}
 
+	//
+	// ArcIterator
+	//
+	template<typename N, typename vertex_data_t>
+	Graph<N, vertex_data_t>::ArcIterator::ArcIterator(typename std::vector<Edge<N, vertex_data_t> *>::const_iterator pIt, Vertex<N, vertex_data_t> * pSrc) :
+		it(pIt),
+		src(pSrc)
+	{
+	}
+
+	template<typename N, typename vertex_data_t>
+	bool Graph<N, vertex_data_t>::ArcIterator::operator!=(const ArcIterator & other) const
+	{
+		return this->it != other.it;
+	}
+
+	template<typename N, typename vertex_data_t>
+	Arc<N> Graph<N, vertex_data_t>::ArcIterator::operator*() const
+	{
+		Edge<N, vertex_data_t> * edge = *this->it;
+		return Arc<N>(edge->target(this->src)->getId(), edge->cost());
+	}
+
+	template<typename N, typename vertex_data_t>
+	auto Graph<N, vertex_data_t>::ArcIterator::operator++() -> ArcIterator &
+	{
+		++this->it;
+		return *this;
+	}
+
 }
\ No newline at end of file
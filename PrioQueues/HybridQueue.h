@@ -0,0 +1,405 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PriorityQueue.h"
+#include "AlignedAllocator.h"
+#include "SimdOps.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		                flat array      heap
+		insert		-> O(1)            O(log_D n)
+		findMin		-> O(n)            O(1)
+		decreaseKey	-> O(1)            O(log_D n)
+		meld		-> O(n + m)        O(n + m)
+		deleteMin	-> O(n)            O(D log_D n)
+
+		< Template parameters >
+
+		Threshold -> size above which the queue turns into a heap.
+		D         -> arity of the heap.
+		Order     -> ordering policy (MinOrder, MaxOrder).
+
+		Queue for small frontiers, e.g. label-set searches on road graphs. Up to Threshold
+		elements it is an unordered flat array and deleteMin just scans it, which for
+		a few hundred elements beats heaps that chase pointers. Once it grows over
+		Threshold the same array is heapified in place into an implicit D-ary heap,
+		and when it shrinks to Threshold / 2 it stops keeping the heap order again
+		(a heap is a valid unordered array, so switching back costs nothing).
+		Priorities and items are kept in two parallel arrays, so the scan reads only
+		the priorities (with MinOrder it is vectorized, see SimdOps). Items hold their position in the arrays, which every move updates,
+		so entries returned from insert stay valid across both switches.
+	*/
+	template<typename N, typename E, size_t Threshold = 128, int D = 4, typename Order = MinOrder<N>>
+	class HybridQueue final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class HybridItem;
+
+	private:
+
+		std::vector<N, AlignedAllocator<N>> prios;
+		std::vector<HybridItem*> items;
+		bool heapMode;
+
+	public:
+
+		typedef HybridItem entry_t;
+
+		HybridQueue();
+		virtual ~HybridQueue();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+		void reserve(size_t n)                                  override;
+
+		/**
+			@return true if the elements are kept in heap order, false if in a flat array.
+		*/
+		bool isHeap() const;
+
+	private:
+
+		size_t findMinIndex() const;
+		size_t findMinIndex(std::true_type vectorized) const;
+		size_t findMinIndex(std::false_type vectorized) const;
+		void place(size_t index, N prio, HybridItem * item);
+		void siftUp(size_t index);
+		void siftDown(size_t index);
+		void heapify();
+
+	private:
+
+		class HybridItem : public QueueEntry<N, E>
+		{
+		public:
+
+			size_t index;
+
+			HybridItem(E pData, N pPrio, size_t pIndex);
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	//
+	// HybridItem
+	//
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	HybridQueue<N, E, Threshold, D, Order>::HybridItem::HybridItem(E pData, N pPrio, size_t pIndex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		index(pIndex)
+	{
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::HybridItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	//
+	// HybridQueue
+	//
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	HybridQueue<N, E, Threshold, D, Order>::HybridQueue() :
+		heapMode(false)
+	{
+		static_assert(D >= 2, "Arity of the heap must be at least 2.");
+		static_assert(Threshold >= 2, "Threshold must be at least 2.");
+
+		this->prios.reserve(Threshold);
+		this->items.reserve(Threshold);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	HybridQueue<N, E, Threshold, D, Order>::~HybridQueue()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	QueueEntry<N, E> * HybridQueue<N, E, Threshold, D, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	QueueEntry<N, E> * HybridQueue<N, E, Threshold, D, Order>::insert(E && data, N prio)
+	{
+		const size_t index = this->items.size();
+
+		auto * newItem = new HybridItem(std::move(data), prio, index);
+		this->prios.push_back(prio);
+		this->items.push_back(newItem);
+
+		if (this->heapMode)
+		{
+			this->siftUp(index);
+		}
+		else if (this->items.size() > Threshold)
+		{
+			this->heapify();
+			this->heapMode = true;
+		}
+
+		return newItem;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(item, newPrio);
+
+		item.setPrio(newPrio);
+		this->prios[item.index] = newPrio;
+
+		if (this->heapMode)
+		{
+			this->siftUp(item.index);
+		}
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	PriorityQueue<N, E> * HybridQueue<N, E, Threshold, D, Order>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherHybrid = dynamic_cast<HybridQueue<N, E, Threshold, D, Order> *>(other);
+
+		if (!otherHybrid)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		const size_t oldSize = this->items.size();
+		this->prios.insert(this->prios.end(), otherHybrid->prios.begin(), otherHybrid->prios.end());
+		this->items.insert(this->items.end(), otherHybrid->items.begin(), otherHybrid->items.end());
+		otherHybrid->prios.clear();
+		otherHybrid->items.clear();
+		otherHybrid->heapMode = false;
+
+		for (size_t i = oldSize; i < this->items.size(); i++)
+		{
+			this->items[i]->index = i;
+		}
+
+		this->heapMode = this->items.size() > Threshold;
+		if (this->heapMode)
+		{
+			this->heapify();
+		}
+
+		return this;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	std::pair<E, N> HybridQueue<N, E, Threshold, D, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		const size_t minIndex = this->heapMode ? 0 : this->findMinIndex();
+		HybridItem * poped = this->items[minIndex];
+		const N lastPrio = this->prios.back();
+		HybridItem * last = this->items.back();
+		this->prios.pop_back();
+		this->items.pop_back();
+
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		if (minIndex < this->items.size())
+		{
+			this->place(minIndex, lastPrio, last);
+
+			if (this->heapMode)
+			{
+				this->siftDown(minIndex);
+			}
+		}
+
+		if (this->heapMode && this->items.size() <= Threshold / 2)
+		{
+			this->heapMode = false;
+		}
+
+		return popedData;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	E HybridQueue<N, E, Threshold, D, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	E & HybridQueue<N, E, Threshold, D, Order>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->items[this->heapMode ? 0 : this->findMinIndex()]->getData();
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	size_t HybridQueue<N, E, Threshold, D, Order>::size()
+	{
+		return this->items.size();
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::clear()
+	{
+		for (HybridItem * item : this->items)
+		{
+			delete item;
+		}
+
+		this->prios.clear();
+		this->items.clear();
+		this->heapMode = false;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::reserve(const size_t n)
+	{
+		this->prios.reserve(n);
+		this->items.reserve(n);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	bool HybridQueue<N, E, Threshold, D, Order>::isHeap() const
+	{
+		return this->heapMode;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	size_t HybridQueue<N, E, Threshold, D, Order>::findMinIndex() const
+	{
+		return this->findMinIndex(std::is_same<Order, MinOrder<N>>());
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	size_t HybridQueue<N, E, Threshold, D, Order>::findMinIndex(std::true_type) const
+	{
+		return SimdOps::minIndex(this->prios.data(), this->prios.size());
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	size_t HybridQueue<N, E, Threshold, D, Order>::findMinIndex(std::false_type) const
+	{
+		// only the priority array is read, so the scan walks one contiguous array
+		const N * prio = this->prios.data();
+		const size_t count = this->prios.size();
+		size_t minIndex = 0;
+
+		for (size_t i = 1; i < count; i++)
+		{
+			if (Order::before(prio[i], prio[minIndex]))
+			{
+				minIndex = i;
+			}
+		}
+
+		return minIndex;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::place(const size_t index, N prio, HybridItem * item)
+	{
+		this->prios[index] = prio;
+		this->items[index] = item;
+		item->index = index;
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::siftUp(size_t index)
+	{
+		const N movedPrio = this->prios[index];
+		HybridItem * movedItem = this->items[index];
+
+		while (index > 0)
+		{
+			const size_t parentIndex = (index - 1) / D;
+
+			if (!Order::before(movedPrio, this->prios[parentIndex])) break;
+
+			this->place(index, this->prios[parentIndex], this->items[parentIndex]);
+			index = parentIndex;
+		}
+
+		this->place(index, movedPrio, movedItem);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::siftDown(size_t index)
+	{
+		const N movedPrio = this->prios[index];
+		HybridItem * movedItem = this->items[index];
+		const size_t count = this->items.size();
+
+		for (;;)
+		{
+			const size_t firstChild = index * D + 1;
+
+			if (firstChild >= count) break;
+
+			const size_t lastChild = firstChild + D < count ? firstChild + D : count;
+			size_t minChild = firstChild;
+			for (size_t child = firstChild + 1; child < lastChild; child++)
+			{
+				if (Order::before(this->prios[child], this->prios[minChild]))
+				{
+					minChild = child;
+				}
+			}
+
+			if (!Order::before(this->prios[minChild], movedPrio)) break;
+
+			this->place(index, this->prios[minChild], this->items[minChild]);
+			index = minChild;
+		}
+
+		this->place(index, movedPrio, movedItem);
+	}
+
+	template<typename N, typename E, size_t Threshold, int D, typename Order>
+	void HybridQueue<N, E, Threshold, D, Order>::heapify()
+	{
+		const size_t count = this->items.size();
+
+		if (count > 1)
+		{
+			for (size_t i = (count - 2) / D + 1; i > 0; i--)
+			{
+				this->siftDown(i - 1);
+			}
+		}
+	}
+
+}
\ No newline at end of file
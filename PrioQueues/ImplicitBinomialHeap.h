@@ -0,0 +1,397 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+#include "PriorityQueue.h"
+#include "NodePool.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(log n), O(1) amortized
+		findMin		-> O(1)
+		decreaseKey	-> O(log n)
+		meld		-> O(n + m)
+		deleteMin	-> O(log n)
+
+		< Template parameters >
+
+		Alloc -> allocator of the entries (NewAllocator, PoolAllocator).
+		Order -> ordering policy (MinOrder, MaxOrder).
+
+		Binomial queue without tree nodes. The forest is stored implicitly in arrays
+		as a weak heap: element i has children 2i and 2i + 1 and one reverse bit
+		which says which of them is the left one, and every element precedes all
+		elements in its right subtree. A weak heap of 2^k elements is exactly a binomial
+		tree of rank k, so linking two trees is a single comparison which, if the roots
+		are in the wrong order, swaps the two entries and flips one reverse bit instead
+		of relinking pointers.
+		Per element there is a priority, a pointer to the entry and one bit,
+		and the entry holds its position in the arrays, which every swap updates,
+		so entries returned from insert stay valid.
+	*/
+	template<typename N, typename E, template<typename> class Alloc = NewAllocator, typename Order = MinOrder<N>>
+	class ImplicitBinomialHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class ImplicitItem;
+
+	private:
+
+		std::vector<N> prios;
+		std::vector<ImplicitItem*> items;
+		std::vector<bool> reverse;
+		Alloc<ImplicitItem> entries;
+
+	public:
+
+		typedef ImplicitItem entry_t;
+
+		ImplicitBinomialHeap();
+		virtual ~ImplicitBinomialHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+		void reserve(size_t n)                                  override;
+
+	private:
+
+		void append(ImplicitItem * item, N prio);
+		void addLeaf(size_t index);
+		size_t distinguishedAncestor(size_t index) const;
+		bool join(size_t ancestor, size_t index);
+		void swapEntries(size_t first, size_t second);
+		void siftUp(size_t index);
+		void siftDown();
+		void rebuild();
+
+	private:
+
+		class ImplicitItem : public QueueEntry<N, E>
+		{
+		public:
+
+			size_t index;
+
+			ImplicitItem(E pData, N pPrio, size_t pIndex);
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	//
+	// ImplicitItem
+	//
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	ImplicitBinomialHeap<N, E, Alloc, Order>::ImplicitItem::ImplicitItem(E pData, N pPrio, size_t pIndex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		index(pIndex)
+	{
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::ImplicitItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	//
+	// ImplicitBinomialHeap
+	//
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	ImplicitBinomialHeap<N, E, Alloc, Order>::ImplicitBinomialHeap()
+	{
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	ImplicitBinomialHeap<N, E, Alloc, Order>::~ImplicitBinomialHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	QueueEntry<N, E> * ImplicitBinomialHeap<N, E, Alloc, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	QueueEntry<N, E> * ImplicitBinomialHeap<N, E, Alloc, Order>::insert(E && data, N prio)
+	{
+		ImplicitItem * newItem = this->entries.create(std::move(data), prio, this->items.size());
+		this->append(newItem, prio);
+		this->addLeaf(newItem->index);
+
+		return newItem;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt ImplicitBinomialHeap<N, E, Alloc, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		const size_t oldSize = this->items.size();
+
+		for (; first != last; ++first)
+		{
+			ImplicitItem * newItem = this->entries.create(first->first, first->second, this->items.size());
+			this->append(newItem, first->second);
+			*out++ = newItem;
+		}
+
+		// building the whole heap at once costs fewer comparisons than sifting up a big batch
+		if (this->items.size() - oldSize >= oldSize)
+		{
+			this->rebuild();
+		}
+		else
+		{
+			for (size_t i = oldSize; i < this->items.size(); i++)
+			{
+				this->addLeaf(i);
+			}
+		}
+
+		return out;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(item, newPrio);
+
+		item.setPrio(newPrio);
+		this->prios[item.index] = newPrio;
+		this->siftUp(item.index);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	PriorityQueue<N, E> * ImplicitBinomialHeap<N, E, Alloc, Order>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherImplicit = dynamic_cast<ImplicitBinomialHeap<N, E, Alloc, Order> *>(other);
+
+		if (!otherImplicit)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		for (size_t i = 0; i < otherImplicit->items.size(); i++)
+		{
+			ImplicitItem * item = otherImplicit->items[i];
+			item->index = this->items.size();
+			this->append(item, otherImplicit->prios[i]);
+		}
+
+		otherImplicit->prios.clear();
+		otherImplicit->items.clear();
+		otherImplicit->reverse.clear();
+		this->entries.absorb(otherImplicit->entries);
+
+		this->rebuild();
+
+		return this;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	std::pair<E, N> ImplicitBinomialHeap<N, E, Alloc, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		ImplicitItem * poped = this->items[0];
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		this->entries.destroy(poped);
+
+		const size_t lastIndex = this->items.size() - 1;
+		if (lastIndex > 0)
+		{
+			this->prios[0] = this->prios[lastIndex];
+			this->items[0] = this->items[lastIndex];
+			this->items[0]->index = 0;
+		}
+
+		this->prios.pop_back();
+		this->items.pop_back();
+		this->reverse.pop_back();
+
+		if (this->items.size() > 1)
+		{
+			this->siftDown();
+		}
+
+		return popedData;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	E ImplicitBinomialHeap<N, E, Alloc, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	E & ImplicitBinomialHeap<N, E, Alloc, Order>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->items[0]->getData();
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	size_t ImplicitBinomialHeap<N, E, Alloc, Order>::size()
+	{
+		return this->items.size();
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::clear()
+	{
+		if (canReleaseAll<Alloc<ImplicitItem>, N, E>())
+		{
+			this->entries.releaseAll();
+		}
+		else
+		{
+			for (ImplicitItem * item : this->items)
+			{
+				this->entries.destroy(item);
+			}
+		}
+
+		this->prios.clear();
+		this->items.clear();
+		this->reverse.clear();
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::reserve(const size_t n)
+	{
+		this->prios.reserve(n);
+		this->items.reserve(n);
+		this->reverse.reserve(n);
+		this->entries.reserve(n);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::append(ImplicitItem * item, N prio)
+	{
+		this->prios.push_back(prio);
+		this->items.push_back(item);
+		this->reverse.push_back(false);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::addLeaf(const size_t index)
+	{
+		// parent of a new left leaf had no children, so its reverse bit means nothing yet
+		if (index > 0 && (index & 1) == 0)
+		{
+			this->reverse[index >> 1] = false;
+		}
+
+		this->siftUp(index);
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	size_t ImplicitBinomialHeap<N, E, Alloc, Order>::distinguishedAncestor(size_t index) const
+	{
+		// climbs while the element is a left child, parent of the first right child is the answer
+		while ((index & 1) == static_cast<size_t>(this->reverse[index >> 1]))
+		{
+			index >>= 1;
+		}
+
+		return index >> 1;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	bool ImplicitBinomialHeap<N, E, Alloc, Order>::join(const size_t ancestor, const size_t index)
+	{
+		if (Order::before(this->prios[index], this->prios[ancestor]))
+		{
+			this->swapEntries(ancestor, index);
+			this->reverse[index] = !this->reverse[index];
+			return false;
+		}
+
+		return true;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::swapEntries(const size_t first, const size_t second)
+	{
+		std::swap(this->prios[first], this->prios[second]);
+		std::swap(this->items[first], this->items[second]);
+		this->items[first]->index = first;
+		this->items[second]->index = second;
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::siftUp(size_t index)
+	{
+		while (index != 0)
+		{
+			const size_t ancestor = this->distinguishedAncestor(index);
+
+			if (this->join(ancestor, index)) break;
+
+			index = ancestor;
+		}
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::siftDown()
+	{
+		// new root is joined with the roots of all trees on the path of left children from element 1
+		const size_t count = this->items.size();
+		size_t index = 1;
+
+		while (2 * index + this->reverse[index] < count)
+		{
+			index = 2 * index + this->reverse[index];
+		}
+
+		while (index != 0)
+		{
+			this->join(0, index);
+			index >>= 1;
+		}
+	}
+
+	template<typename N, typename E, template<typename> class Alloc, typename Order>
+	void ImplicitBinomialHeap<N, E, Alloc, Order>::rebuild()
+	{
+		std::fill(this->reverse.begin(), this->reverse.end(), false);
+
+		for (size_t i = this->items.size(); i > 1; i--)
+		{
+			this->join(this->distinguishedAncestor(i - 1), i - 1);
+		}
+	}
+
+}
\ No newline at end of file
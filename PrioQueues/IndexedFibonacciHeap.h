@@ -0,0 +1,683 @@
+#pragma once
+#include <stdexcept>
+#include <vector>
+#include "PriorityQueue.h"
+#include "NodePool.h"
+#include "BitOps.h"
+
+#define ever ;;
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(1)
+		findMin		-> O(1)
+		decreaseKey	-> O(1) amortized
+		meld		-> O(m)
+		deleteMin	-> O(log n) amortized
+
+		< Template parameters >
+
+		Order -> ordering policy (MinOrder, MaxOrder).
+
+		Fibonacci heap with the same linking, cuts and cascading cuts as FibonacciHeap,
+		but its nodes live in one IndexPool and link each other by 32 bit indices.
+		A node is thus 40 instead of 56 bytes (for 8 byte priority and 4 byte element)
+		and nodes of a heap are close to each other, so consolidateRoots,
+		which follows the links of all roots, misses the cache less often.
+		The rank table of consolidateRoots is a fixed array on the stack.
+		meld has to shift the indices in all nodes of the other heap, so it is O(m).
+	*/
+	template<typename N, typename E, typename Order = MinOrder<N>>
+	class IndexedFibonacciHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class IndexedFibNode;
+
+		typedef IndexPool<IndexedFibNode> pool_t;
+		typedef typename pool_t::index_t index_t;
+
+		static const index_t Null = pool_t::Null;
+		static const int MaxRank = 64;
+
+	private:
+
+		size_t dataSize;
+		index_t minItem;
+		pool_t nodes;
+
+	public:
+
+		typedef IndexedFibNode entry_t;
+
+		IndexedFibonacciHeap();
+		virtual ~IndexedFibonacciHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		template<typename... Args>
+		QueueEntry<N, E> * emplace(N prio, Args &&... args);
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+		void reserve(size_t n)                                  override;
+
+	private:
+
+		IndexedFibNode & node(index_t index);
+		bool before(index_t first, index_t second);
+		void addOneItem(IndexedFibNode & newItem);
+		void addMoreItems(index_t item);
+		void addChild(IndexedFibNode & parent, IndexedFibNode & newChild);
+		void removeChild(IndexedFibNode & parent, IndexedFibNode & child);
+		void removeFromList(const IndexedFibNode & item);
+		IndexedFibNode & merge(IndexedFibNode & first, IndexedFibNode & second);
+		index_t disconectChildren(index_t parent);
+		void cutChild(IndexedFibNode & child);
+		void removeMinItem();
+		void consolidateRoots();
+		void collectNodes(std::vector<index_t> & out);
+		void destroyNodes();
+
+	private:
+
+		class IndexedFibNode : public QueueEntry<N, E>
+		{
+		public:
+
+			index_t self;
+			index_t parent;
+			index_t prev;
+			index_t next;
+			index_t child;
+			unsigned char rank;
+			bool marked;
+
+			IndexedFibNode(E data, N prio);
+			template<typename... Args>
+			IndexedFibNode(emplace_tag tag, N prio, Args &&... args);
+
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	//
+	// IndexedFibNode
+	//
+	template<typename N, typename E, typename Order>
+	IndexedFibonacciHeap<N, E, Order>::IndexedFibNode::IndexedFibNode(E data, N prio) :
+		QueueEntry<N, E>(std::move(data), prio),
+		self(Null),
+		parent(Null),
+		prev(Null),
+		next(Null),
+		child(Null),
+		rank(0),
+		marked(false)
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	template<typename... Args>
+	IndexedFibonacciHeap<N, E, Order>::IndexedFibNode::IndexedFibNode(emplace_tag tag, N prio, Args &&... args) :
+		QueueEntry<N, E>(tag, prio, std::forward<Args>(args)...),
+		self(Null),
+		parent(Null),
+		prev(Null),
+		next(Null),
+		child(Null),
+		rank(0),
+		marked(false)
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::IndexedFibNode::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	//
+	// IndexedFibonacciHeap
+	//
+	template<typename N, typename E, typename Order>
+	IndexedFibonacciHeap<N, E, Order>::IndexedFibonacciHeap() :
+		dataSize(0),
+		minItem(Null)
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	IndexedFibonacciHeap<N, E, Order>::~IndexedFibonacciHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E>* IndexedFibonacciHeap<N, E, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E>* IndexedFibonacciHeap<N, E, Order>::insert(E && data, N prio)
+	{
+		const index_t newIndex = this->nodes.create(std::move(data), prio);
+		IndexedFibNode & newItem = this->node(newIndex);
+		newItem.self = newIndex;
+
+		this->addOneItem(newItem);
+		++this->dataSize;
+
+		return &newItem;
+	}
+
+	template<typename N, typename E, typename Order>
+	template<typename... Args>
+	QueueEntry<N, E>* IndexedFibonacciHeap<N, E, Order>::emplace(N prio, Args &&... args)
+	{
+		const index_t newIndex = this->nodes.create(emplace_tag(), prio, std::forward<Args>(args)...);
+		IndexedFibNode & newItem = this->node(newIndex);
+		newItem.self = newIndex;
+
+		this->addOneItem(newItem);
+		++this->dataSize;
+
+		return &newItem;
+	}
+
+	template<typename N, typename E, typename Order>
+	template<typename InputIt, typename OutputIt>
+	OutputIt IndexedFibonacciHeap<N, E, Order>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		if (first == last)
+		{
+			return out;
+		}
+
+		// new nodes form their own root list, which is spliced into the heap at once
+		const index_t head = this->nodes.create(first->first, first->second);
+		this->node(head).self = head;
+		index_t tail = head;
+		index_t min = head;
+		*out++ = &this->node(head);
+		++this->dataSize;
+
+		for (++first; first != last; ++first)
+		{
+			const index_t newItem = this->nodes.create(first->first, first->second);
+			this->node(newItem).self = newItem;
+			this->node(tail).next = newItem;
+			this->node(newItem).prev = tail;
+			tail = newItem;
+
+			if (this->before(newItem, min))
+			{
+				min = newItem;
+			}
+
+			*out++ = &this->node(newItem);
+			++this->dataSize;
+		}
+
+		this->node(tail).next = head;
+		this->node(head).prev = tail;
+
+		if (this->minItem == Null)
+		{
+			this->minItem = min;
+		}
+		else
+		{
+			this->addMoreItems(head);
+
+			if (this->before(min, this->minItem))
+			{
+				this->minItem = min;
+			}
+		}
+
+		return out;
+	}
+
+	template<typename N, typename E, typename Order>
+	std::pair<E, N> IndexedFibonacciHeap<N, E, Order>::popMin()
+	{
+		if (this->dataSize == 0)
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		IndexedFibNode & min = this->node(this->minItem);
+		std::pair<E, N> retData(std::move(min.getData()), min.getPrio());
+		--this->dataSize;
+
+		this->removeMinItem();
+
+		if (!this->isEmpty())
+		{
+			this->consolidateRoots();
+		}
+
+		return retData;
+	}
+
+	template<typename N, typename E, typename Order>
+	E IndexedFibonacciHeap<N, E, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Order>
+	E & IndexedFibonacciHeap<N, E, Order>::findMin()
+	{
+		if (this->dataSize == 0)
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->node(this->minItem).getData();
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t IndexedFibonacciHeap<N, E, Order>::size()
+	{
+		return this->dataSize;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::decreaseKey(entry_t & entry, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(entry, newPrio);
+
+		entry.setPrio(newPrio);
+
+		if (entry.parent != Null && Order::before(newPrio, this->node(entry.parent).getPrio()))
+		{
+			this->cutChild(entry);
+		}
+		else if (Order::before(newPrio, this->node(this->minItem).getPrio()))
+		{
+			this->minItem = entry.self;
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	PriorityQueue<N, E>* IndexedFibonacciHeap<N, E, Order>::meld(PriorityQueue<N, E>* other)
+	{
+		auto * otherFib = dynamic_cast<IndexedFibonacciHeap<N, E, Order> *>(other);
+
+		if (!otherFib)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+		else if (this->isEmpty())
+		{
+			return other;
+		}
+		else if (otherFib->isEmpty())
+		{
+			return this;
+		}
+
+		// nodes of other stay where they are, only their indices are shifted behind the nodes of this heap
+		std::vector<index_t> otherItems;
+		otherFib->collectNodes(otherItems);
+
+		const index_t offset = this->nodes.absorb(otherFib->nodes);
+		for (const index_t otherItem : otherItems)
+		{
+			IndexedFibNode & moved = this->node(otherItem + offset);
+			moved.self += offset;
+			moved.prev += offset;
+			moved.next += offset;
+			if (moved.parent != Null) moved.parent += offset;
+			if (moved.child != Null) moved.child += offset;
+		}
+
+		const index_t otherMin = otherFib->minItem + offset;
+		this->dataSize += otherFib->dataSize;
+		this->addMoreItems(otherMin);
+
+		if (this->before(otherMin, this->minItem))
+		{
+			this->minItem = otherMin;
+		}
+
+		otherFib->dataSize = 0;
+		otherFib->minItem = Null;
+
+		return this;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::clear()
+	{
+		if (this->minItem == Null)
+		{
+			return;
+		}
+
+		if (canReleaseAll<pool_t, N, E>())
+		{
+			this->nodes.releaseAll();
+		}
+		else
+		{
+			this->destroyNodes();
+		}
+
+		this->minItem = Null;
+		this->dataSize = 0;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::reserve(const size_t n)
+	{
+		this->nodes.reserve(n);
+	}
+
+	template<typename N, typename E, typename Order>
+	auto IndexedFibonacciHeap<N, E, Order>::node(const index_t index) -> IndexedFibNode &
+	{
+		return this->nodes[index];
+	}
+
+	template<typename N, typename E, typename Order>
+	bool IndexedFibonacciHeap<N, E, Order>::before(const index_t first, const index_t second)
+	{
+		return Order::before(this->node(first).getPrio(), this->node(second).getPrio());
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::addOneItem(IndexedFibNode & newItem)
+	{
+		if (this->minItem == Null)
+		{
+			this->minItem = newItem.self;
+			newItem.next = newItem.self;
+			newItem.prev = newItem.self;
+			return;
+		}
+
+		IndexedFibNode & min = this->node(this->minItem);
+		newItem.prev = this->minItem;
+		newItem.next = min.next;
+		this->node(min.next).prev = newItem.self;
+		min.next = newItem.self;
+
+		if (Order::before(newItem.getPrio(), min.getPrio()))
+		{
+			this->minItem = newItem.self;
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::addMoreItems(const index_t item)
+	{
+		const index_t leftLeft = this->minItem;
+		const index_t rightRight = this->node(this->minItem).next;
+
+		const index_t leftRight = item;
+		const index_t rightLeft = this->node(item).prev;
+
+		this->node(leftLeft).next = leftRight;
+		this->node(leftRight).prev = leftLeft;
+
+		this->node(rightLeft).next = rightRight;
+		this->node(rightRight).prev = rightLeft;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::addChild(IndexedFibNode & parent, IndexedFibNode & newChild)
+	{
+		if (parent.child == Null)
+		{
+			parent.child = newChild.self;
+			newChild.next = newChild.self;
+			newChild.prev = newChild.self;
+		}
+		else
+		{
+			IndexedFibNode & firstChild = this->node(parent.child);
+			newChild.next = firstChild.next;
+			newChild.prev = parent.child;
+			this->node(firstChild.next).prev = newChild.self;
+			firstChild.next = newChild.self;
+		}
+
+		newChild.parent = parent.self;
+		++parent.rank;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::removeChild(IndexedFibNode & parent, IndexedFibNode & child)
+	{
+		if (child.self == child.next)
+		{
+			parent.child = Null;
+		}
+		else
+		{
+			if (child.self == parent.child)
+			{
+				parent.child = child.next;
+			}
+
+			this->removeFromList(child);
+		}
+
+		child.parent = Null;
+		--parent.rank;
+
+		if (parent.parent != Null)
+		{
+			parent.marked = true;
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::removeFromList(const IndexedFibNode & item)
+	{
+		this->node(item.prev).next = item.next;
+		this->node(item.next).prev = item.prev;
+	}
+
+	template<typename N, typename E, typename Order>
+	auto IndexedFibonacciHeap<N, E, Order>::merge(IndexedFibNode & first, IndexedFibNode & second) -> IndexedFibNode &
+	{
+		if (Order::before(first.getPrio(), second.getPrio()))
+		{
+			this->removeFromList(second);
+			this->addChild(first, second);
+			return first;
+		}
+		else
+		{
+			this->removeFromList(first);
+			this->addChild(second, first);
+			return second;
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	auto IndexedFibonacciHeap<N, E, Order>::disconectChildren(const index_t parent) -> index_t
+	{
+		IndexedFibNode & parentNode = this->node(parent);
+		const index_t retChild = parentNode.child;
+
+		if (retChild != Null)
+		{
+			index_t iterated = retChild;
+			do {
+				IndexedFibNode & iteratedNode = this->node(iterated);
+				iteratedNode.parent = Null;
+				iteratedNode.marked = false;
+				iterated = iteratedNode.next;
+			} while (iterated != retChild);
+
+			parentNode.child = Null;
+			parentNode.rank = 0;
+		}
+
+		return retChild;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::cutChild(IndexedFibNode & child)
+	{
+		IndexedFibNode & parent = this->node(child.parent);
+		const bool goUp = parent.marked;
+
+		this->removeChild(parent, child);
+		child.marked = false;
+		this->addOneItem(child);
+
+		if (goUp)
+		{
+			this->cutChild(parent);
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::removeMinItem()
+	{
+		const index_t children = this->disconectChildren(this->minItem);
+		const index_t oldMin = this->minItem;
+
+		if (oldMin == this->node(oldMin).next)
+		{
+			this->minItem = children;
+			this->nodes.destroy(oldMin);
+		}
+		else
+		{
+			this->removeFromList(this->node(oldMin));
+			this->minItem = this->node(oldMin).next;
+			this->nodes.destroy(oldMin);
+
+			if (children != Null)
+			{
+				this->addMoreItems(children);
+			}
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::consolidateRoots()
+	{
+		// rank of a node with n descendants is at most log_phi(n) < 1.5 * log2(n)
+		const int maxRank = (BitOps::highestSetBit(this->dataSize) + 1) * 3 / 2 + 1;
+
+		IndexedFibNode * aux[MaxRank];
+		for (int rank = 0; rank < maxRank; rank++)
+		{
+			aux[rank] = nullptr;
+		}
+
+		IndexedFibNode * item = &this->node(this->minItem);
+		const index_t last = item->prev;
+		bool endIt(false);
+
+		for (ever)
+		{
+			const index_t nextIt = item->next;
+
+			if (item->self == last)
+			{
+				endIt = true;
+			}
+
+			for (ever)
+			{
+				const int rank = item->rank;
+
+				if (!aux[rank])
+				{
+					aux[rank] = item;
+					break;
+				}
+				else
+				{
+					item = &this->merge(*aux[rank], *item);
+					aux[rank] = nullptr;
+				}
+			}
+
+			if (endIt) break;
+
+			item = &this->node(nextIt);
+		}
+
+		IndexedFibNode * min = nullptr;
+
+		for (int rank = 0; rank < maxRank; rank++)
+		{
+			if (!aux[rank]) continue;
+
+			if (!min || Order::before(aux[rank]->getPrio(), min->getPrio()))
+			{
+				min = aux[rank];
+			}
+		}
+
+		this->minItem = min->self;
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::collectNodes(std::vector<index_t> & out)
+	{
+		// every list of siblings is a circle, out is used as a queue of nodes whose children were not listed yet
+		out.reserve(this->dataSize);
+
+		index_t root = this->minItem;
+		do {
+			out.push_back(root);
+			root = this->node(root).next;
+		} while (root != this->minItem);
+
+		for (size_t i = 0; i < out.size(); i++)
+		{
+			const index_t firstChild = this->node(out[i]).child;
+
+			if (firstChild == Null) continue;
+
+			index_t child = firstChild;
+			do {
+				out.push_back(child);
+				child = this->node(child).next;
+			} while (child != firstChild);
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	void IndexedFibonacciHeap<N, E, Order>::destroyNodes()
+	{
+		std::vector<index_t> items;
+		this->collectNodes(items);
+
+		for (const index_t item : items)
+		{
+			this->nodes.destroy(item);
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include "PriorityQueue.h"
+#include "vid_t.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(log n)
+		findMin		-> O(1)
+		decreaseKey	-> O(log n)
+		deleteMin	-> O(log n)
+
+		< Template parameters >
+
+		N           -> priority comparable with operator<().
+		PositionMap -> per-vertex records that hold position of every vertex in the heap.
+					   It has to provide:
+					   vid_t getHeapIndex(vid_t id) const -> NotInHeap for vertices that are not in the heap,
+					   void setHeapIndex(vid_t id, vid_t index),
+					   static const vid_t NotInHeap.
+		Order       -> ordering policy (MinOrder, MaxOrder).
+
+		Binary heap of vertex ids that allocates nothing per item. The array stores
+		(priority, id) pairs and the position of each vertex is kept in its own record
+		in PositionMap, so decreaseKey goes from the vertex id straight to its slot.
+		Items are identified by vertex ids, there are no entries, so this heap
+		does not implement the PriorityQueue interface.
+	*/
+	template<typename N, typename PositionMap, typename Order = MinOrder<N>>
+	class IntrusiveBinaryHeap final
+	{
+	private:
+
+		struct Slot
+		{
+			N prio;
+			vid_t id;
+		};
+
+	private:
+
+		std::vector<Slot> slots;
+		PositionMap * positions;
+
+	public:
+
+		explicit IntrusiveBinaryHeap(PositionMap * pPositions);
+		IntrusiveBinaryHeap(const IntrusiveBinaryHeap & other) = delete;
+		IntrusiveBinaryHeap & operator=(const IntrusiveBinaryHeap & other) = delete;
+
+		void insert(vid_t id, N prio);
+
+		/**
+			@param id      Vertex in the heap.
+			@param newPrio Must be lower or equal than current priority of the vertex.
+		*/
+		void decreaseKey(vid_t id, N newPrio);
+
+		/**
+			Throws std::out_of_range if heap is empty.
+			@return Vertex with highest priority and its priority.
+		*/
+		std::pair<vid_t, N> popMin();
+
+		vid_t findMin() const;
+		bool contains(vid_t id) const;
+		size_t size() const;
+		bool isEmpty() const;
+
+		/**
+			Removes all vertices, but does not touch their records in PositionMap.
+			The caller has to forget them itself (DijkstraContext does it by starting new epoch).
+		*/
+		void clear();
+		void reserve(size_t n);
+
+	private:
+
+		void place(size_t index, const Slot & slot);
+		void siftUp(size_t index);
+		void siftDown(size_t index);
+
+	};
+
+	template<typename N, typename PositionMap, typename Order>
+	IntrusiveBinaryHeap<N, PositionMap, Order>::IntrusiveBinaryHeap(PositionMap * pPositions) :
+		positions(pPositions)
+	{
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::insert(const vid_t id, N prio)
+	{
+		this->slots.push_back(Slot{ prio, id });
+		this->siftUp(this->slots.size() - 1);
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::decreaseKey(const vid_t id, N newPrio)
+	{
+		const vid_t index = this->positions->getHeapIndex(id);
+
+		if (Order::before(this->slots[index].prio, newPrio))
+		{
+			throw std::invalid_argument("New value of the priority must be lower or equal than current value.");
+		}
+
+		this->slots[index].prio = newPrio;
+		this->siftUp(index);
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	std::pair<vid_t, N> IntrusiveBinaryHeap<N, PositionMap, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		const Slot poped = this->slots[0];
+		const Slot last = this->slots.back();
+		this->slots.pop_back();
+
+		this->positions->setHeapIndex(poped.id, PositionMap::NotInHeap);
+
+		if (!this->slots.empty())
+		{
+			this->place(0, last);
+			this->siftDown(0);
+		}
+
+		return std::pair<vid_t, N>(poped.id, poped.prio);
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	vid_t IntrusiveBinaryHeap<N, PositionMap, Order>::findMin() const
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->slots[0].id;
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	bool IntrusiveBinaryHeap<N, PositionMap, Order>::contains(const vid_t id) const
+	{
+		return this->positions->getHeapIndex(id) != PositionMap::NotInHeap;
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	size_t IntrusiveBinaryHeap<N, PositionMap, Order>::size() const
+	{
+		return this->slots.size();
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	bool IntrusiveBinaryHeap<N, PositionMap, Order>::isEmpty() const
+	{
+		return this->slots.empty();
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::clear()
+	{
+		this->slots.clear();
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::reserve(const size_t n)
+	{
+		this->slots.reserve(n);
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::place(const size_t index, const Slot & slot)
+	{
+		this->slots[index] = slot;
+		this->positions->setHeapIndex(slot.id, static_cast<vid_t>(index));
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::siftUp(size_t index)
+	{
+		const Slot moved = this->slots[index];
+
+		while (index > 0)
+		{
+			const size_t parentIndex = (index - 1) >> 1;
+
+			if (!Order::before(moved.prio, this->slots[parentIndex].prio)) break;
+
+			this->place(index, this->slots[parentIndex]);
+			index = parentIndex;
+		}
+
+		this->place(index, moved);
+	}
+
+	template<typename N, typename PositionMap, typename Order>
+	void IntrusiveBinaryHeap<N, PositionMap, Order>::siftDown(size_t index)
+	{
+		const Slot moved = this->slots[index];
+		const size_t count = this->slots.size();
+
+		for (;;)
+		{
+			size_t childIndex = (index << 1) + 1;
+
+			if (childIndex >= count) break;
+
+			if (childIndex + 1 < count && Order::before(this->slots[childIndex + 1].prio, this->slots[childIndex].prio))
+			{
+				++childIndex;
+			}
+
+			if (!Order::before(this->slots[childIndex].prio, moved.prio)) break;
+
+			this->place(index, this->slots[childIndex]);
+			index = childIndex;
+		}
+
+		this->place(index, moved);
+	}
+
+}
\ No newline at end of file
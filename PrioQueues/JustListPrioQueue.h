@@ -6,8 +6,8 @@
 
 namespace uniza_fri {
 
-	template<typename N, typename E>
-	class JustListPrioQueue : public PriorityQueue<N, E>
+	template<typename N, typename E, typename Order = MinOrder<N>>
+	class JustListPrioQueue final : public PriorityQueue<N, E>
 	{
 	private:
 
@@ -19,17 +19,23 @@ namespace uniza_fri {
 
 	public:
 
+		typedef ListEntry entry_t;
+
 		JustListPrioQueue();
 		explicit JustListPrioQueue(size_t initSize);
 		virtual ~JustListPrioQueue();
 
 		QueueEntry<N, E>* insert(const E & data, N prio)       override;
+		QueueEntry<N, E>* insert(E && data, N prio)            override;
 		void decreaseKey(QueueEntry<N, E>& entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E>* meld(PriorityQueue<N, E>* other)  override;
 		E deleteMin()                                          override;
+		std::pair<E, N> popMin()                               override;
 		E & findMin()                                          override;
 		size_t size()                                          override;
 		void clear()                                           override;
+		void reserve(size_t n)                                 override;
 
 	private:
 
@@ -41,8 +47,8 @@ namespace uniza_fri {
 		{
 		public:
 
-			ListEntry(const E & pdata, const N & pprio);
-			virtual ~ListEntry();
+			ListEntry(E pdata, const N & pprio);
+			~ListEntry();
 
 			void setPrio(const N & prio);
 
@@ -53,42 +59,53 @@ namespace uniza_fri {
 	//
 	// JustListPrioQueue
 	//
-	template<typename N, typename E>
-	JustListPrioQueue<N, E>::JustListPrioQueue() :
-		JustListPrioQueue<N, E>(4)
+	template<typename N, typename E, typename Order>
+	JustListPrioQueue<N, E, Order>::JustListPrioQueue() :
+		JustListPrioQueue<N, E, Order>(4)
 	{
 	}
 
-	template<typename N, typename E>
-	JustListPrioQueue<N, E>::JustListPrioQueue(size_t initSize)
+	template<typename N, typename E, typename Order>
+	JustListPrioQueue<N, E, Order>::JustListPrioQueue(size_t initSize)
 	{
 		this->data.reserve(initSize);
 	}
 
-	template<typename N, typename E>
-	JustListPrioQueue<N, E>::~JustListPrioQueue()
+	template<typename N, typename E, typename Order>
+	JustListPrioQueue<N, E, Order>::~JustListPrioQueue()
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E>* JustListPrioQueue<N, E, Order>::insert(const E & data, N prio)
 	{
+		return this->insert(E(data), prio);
 	}
 
-	template<typename N, typename E>
-	QueueEntry<N, E>* JustListPrioQueue<N, E>::insert(const E & data, N prio)
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E>* JustListPrioQueue<N, E, Order>::insert(E && data, N prio)
 	{
-		ListEntry * entry(new ListEntry(data, prio));
+		ListEntry * entry(new ListEntry(std::move(data), prio));
 		this->data.push_back(entry);
 		return entry;
 	}
 
-	template<typename N, typename E>
-	void JustListPrioQueue<N, E>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
+	template<typename N, typename E, typename Order>
+	void JustListPrioQueue<N, E, Order>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, typename Order>
+	void JustListPrioQueue<N, E, Order>::decreaseKey(entry_t & listEntry, N newPrio)
 	{
-		PriorityQueue<N, E>::decKeyLogicCheck(entry, newPrio);
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(listEntry, newPrio);
 
-		ListEntry & listEntry(dynamic_cast<ListEntry&>(entry));
 		listEntry.setPrio(newPrio);
 	}
 
-	template<typename N, typename E>
-	E JustListPrioQueue<N, E>::deleteMin()
+	template<typename N, typename E, typename Order>
+	std::pair<E, N> JustListPrioQueue<N, E, Order>::popMin()
 	{
 		if (this->data.empty())
 		{
@@ -96,7 +113,7 @@ namespace uniza_fri {
 		}
 
 		size_t minIndex(this->findMinIndex());
-		E ret = this->data[minIndex]->getData();
+		std::pair<E, N> ret(std::move(this->data[minIndex]->getData()), this->data[minIndex]->getPrio());
 		delete this->data[minIndex];
 
 		if (this->data.size() > 1)
@@ -109,8 +126,14 @@ namespace uniza_fri {
 		return ret;
 	}
 
-	template<typename N, typename E>
-	E & JustListPrioQueue<N, E>::findMin()
+	template<typename N, typename E, typename Order>
+	E JustListPrioQueue<N, E, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Order>
+	E & JustListPrioQueue<N, E, Order>::findMin()
 	{
 		if (this->data.empty())
 		{
@@ -122,20 +145,20 @@ namespace uniza_fri {
 		}
 	}
 
-	template<typename N, typename E>
-	PriorityQueue<N, E>* JustListPrioQueue<N, E>::meld(PriorityQueue<N, E>* other)
+	template<typename N, typename E, typename Order>
+	PriorityQueue<N, E>* JustListPrioQueue<N, E, Order>::meld(PriorityQueue<N, E>* other)
 	{
 		throw std::exception("Not supported yet.");
 	}
 
-	template<typename N, typename E>
-	size_t JustListPrioQueue<N, E>::size()
+	template<typename N, typename E, typename Order>
+	size_t JustListPrioQueue<N, E, Order>::size()
 	{
 		return this->data.size();
 	}
 
-	template<typename N, typename E>
-	void JustListPrioQueue<N, E>::clear()
+	template<typename N, typename E, typename Order>
+	void JustListPrioQueue<N, E, Order>::clear()
 	{
 		for (ListEntry * entry : this->data)
 		{
@@ -145,15 +168,21 @@ namespace uniza_fri {
 		this->data.clear();
 	}
 
-	template<typename N, typename E>
-	size_t JustListPrioQueue<N, E>::findMinIndex()
+	template<typename N, typename E, typename Order>
+	void JustListPrioQueue<N, E, Order>::reserve(const size_t n)
+	{
+		this->data.reserve(n);
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t JustListPrioQueue<N, E, Order>::findMinIndex()
 	{
 		size_t index(0);
 		size_t minIndex(0);
 
 		for (ListEntry * entry : this->data)
 		{
-			if (*entry < *(this->data[minIndex]))
+			if (Order::before(entry->getPrio(), this->data[minIndex]->getPrio()))
 			{
 				minIndex = index;
 			}
@@ -167,19 +196,19 @@ namespace uniza_fri {
 	//
 	// ListEntry
 	//
-	template<typename N, typename E>
-	JustListPrioQueue<N, E>::ListEntry::ListEntry(const E & pdata, const N & pprio) :
-		QueueEntry<N, E>(pdata, pprio)
+	template<typename N, typename E, typename Order>
+	JustListPrioQueue<N, E, Order>::ListEntry::ListEntry(E pdata, const N & pprio) :
+		QueueEntry<N, E>(std::move(pdata), pprio)
 	{
 	}
 
-	template<typename N, typename E>
-	JustListPrioQueue<N, E>::ListEntry::~ListEntry()
+	template<typename N, typename E, typename Order>
+	JustListPrioQueue<N, E, Order>::ListEntry::~ListEntry()
 	{
 	}
 
-	template<typename N, typename E>
-	void JustListPrioQueue<N, E>::ListEntry::setPrio(const N & prio)
+	template<typename N, typename E, typename Order>
+	void JustListPrioQueue<N, E, Order>::ListEntry::setPrio(const N & prio)
 	{
 		QueueEntry<N, E>::setPrioInternal(prio);
 	}
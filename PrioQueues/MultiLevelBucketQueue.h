@@ -0,0 +1,435 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "PriorityQueue.h"
+#include "RadixHeap.h"
+#include "BitOps.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(1)
+		findMin		-> O(Levels * Radix) amortized
+		decreaseKey	-> O(1)
+		meld		-> O(n + m)
+		deleteMin	-> O(Levels * Radix) amortized
+
+		< Template parameters >
+
+		Levels -> number of bucket levels.
+		Radix  -> number of buckets on each level, must be a power of two.
+
+		Multi-level bucket queue (Cherkassky, Goldberg, Silverstein). Keys (see RadixKey)
+		are read as numbers in base Radix. An item is kept on the level of the highest digit
+		in which its key differs from the key of the last extracted minimum, in the bucket
+		given by its own digit on that level. Items differing above the top level are kept
+		in overflow buckets by the highest differing bit, the same way as in RadixHeap.
+		When the lowest levels run empty, the first non-empty bucket of the next level
+		(or overflow bucket) is expanded into the levels below it.
+
+		With Radix^Levels above the maximal edge weight only items around a carry
+		of the top digit use the overflow buckets, so memory is Levels * Radix buckets
+		instead of the C buckets of BucketQueue.
+
+		Priorities inserted or decreased must never be lower than the last extracted
+		minimum. This is checked only in debug builds (throws std::invalid_argument).
+	*/
+	template<typename N, typename E, int Levels = 3, int Radix = 256>
+	class MultiLevelBucketQueue final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class MultiLevelBucketItem;
+
+		static const int RadixBits = BitOps::floorLog2(Radix);
+		static const int Overflow = Levels * Radix;
+		static const int BucketCount = Overflow + 64 - Levels * RadixBits;
+
+	private:
+
+		std::vector<MultiLevelBucketItem*> buckets[BucketCount];
+		size_t levelSize[Levels];
+		unsigned long long lastKey;
+		size_t dataSize;
+
+	public:
+
+		typedef MultiLevelBucketItem entry_t;
+
+		MultiLevelBucketQueue();
+		virtual ~MultiLevelBucketQueue();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+
+	private:
+
+		int digit(unsigned long long key, int level) const;
+		int bucketIndex(unsigned long long key) const;
+		void placeItem(MultiLevelBucketItem * item);
+		void removeFromBucket(MultiLevelBucketItem * item);
+		std::vector<MultiLevelBucketItem*> & minBucket();
+		void expand(int bucket);
+		void checkMonotone(N prio) const;
+
+	private:
+
+		class MultiLevelBucketItem : public QueueEntry<N, E>
+		{
+		public:
+
+			int bucket;
+			size_t index;
+
+			MultiLevelBucketItem(E pData, N pPrio);
+			~MultiLevelBucketItem() = default;
+			void setPrio(N newPrio);
+			unsigned long long key() const;
+
+		};
+
+	};
+
+	//
+	// MultiLevelBucketItem
+	//
+	template<typename N, typename E, int Levels, int Radix>
+	MultiLevelBucketQueue<N, E, Levels, Radix>::MultiLevelBucketItem::MultiLevelBucketItem(E pData, N pPrio) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		bucket(0),
+		index(0)
+	{
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::MultiLevelBucketItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	unsigned long long MultiLevelBucketQueue<N, E, Levels, Radix>::MultiLevelBucketItem::key() const
+	{
+		return RadixKey<N>::toKey(this->getPrio());
+	}
+
+	//
+	// MultiLevelBucketQueue
+	//
+	template<typename N, typename E, int Levels, int Radix>
+	MultiLevelBucketQueue<N, E, Levels, Radix>::MultiLevelBucketQueue() :
+		lastKey(0),
+		dataSize(0)
+	{
+		static_assert(Levels >= 1, "There must be at least one level.");
+		static_assert(Radix >= 2 && (Radix & (Radix - 1)) == 0, "Radix must be a power of two.");
+		static_assert(Levels * RadixBits <= 64, "Levels would cover more than 64 bits of the key.");
+
+		std::fill(this->levelSize, this->levelSize + Levels, 0);
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	MultiLevelBucketQueue<N, E, Levels, Radix>::~MultiLevelBucketQueue()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	QueueEntry<N, E> * MultiLevelBucketQueue<N, E, Levels, Radix>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	QueueEntry<N, E> * MultiLevelBucketQueue<N, E, Levels, Radix>::insert(E && data, N prio)
+	{
+		this->checkMonotone(prio);
+
+		auto * item = new MultiLevelBucketItem(std::move(data), prio);
+		this->placeItem(item);
+		++this->dataSize;
+
+		return item;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(item, newPrio);
+		this->checkMonotone(newPrio);
+
+		item.setPrio(newPrio);
+
+		if (this->bucketIndex(item.key()) != item.bucket)
+		{
+			this->removeFromBucket(&item);
+			this->placeItem(&item);
+		}
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	PriorityQueue<N, E> * MultiLevelBucketQueue<N, E, Levels, Radix>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherMulti = dynamic_cast<MultiLevelBucketQueue<N, E, Levels, Radix> *>(other);
+
+		if (!otherMulti)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		std::vector<MultiLevelBucketItem*> items;
+		items.reserve(this->dataSize + otherMulti->dataSize);
+
+		for (int i = 0; i < BucketCount; i++)
+		{
+			items.insert(items.end(), this->buckets[i].begin(), this->buckets[i].end());
+			items.insert(items.end(), otherMulti->buckets[i].begin(), otherMulti->buckets[i].end());
+			this->buckets[i].clear();
+			otherMulti->buckets[i].clear();
+		}
+
+		// positions are relative to the last minimum, with the lower one all items can be placed again
+		this->lastKey = std::min(this->lastKey, otherMulti->lastKey);
+		this->dataSize += otherMulti->dataSize;
+		std::fill(this->levelSize, this->levelSize + Levels, 0);
+
+		otherMulti->dataSize = 0;
+		otherMulti->lastKey = 0;
+		std::fill(otherMulti->levelSize, otherMulti->levelSize + Levels, 0);
+
+		for (MultiLevelBucketItem * item : items)
+		{
+			this->placeItem(item);
+		}
+
+		return this;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	std::pair<E, N> MultiLevelBucketQueue<N, E, Levels, Radix>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		std::vector<MultiLevelBucketItem*> & bucket = this->minBucket();
+
+		MultiLevelBucketItem * poped = bucket.back();
+		bucket.pop_back();
+		--this->levelSize[0];
+
+		// the rest of level 0 differs from the popped key only in the lowest digit, no item has to move
+		this->lastKey = poped->key();
+
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		if (--this->dataSize == 0)
+		{
+			this->lastKey = 0;
+		}
+
+		return popedData;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	E MultiLevelBucketQueue<N, E, Levels, Radix>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	E & MultiLevelBucketQueue<N, E, Levels, Radix>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->minBucket().back()->getData();
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	size_t MultiLevelBucketQueue<N, E, Levels, Radix>::size()
+	{
+		return this->dataSize;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::clear()
+	{
+		for (std::vector<MultiLevelBucketItem*> & bucket : this->buckets)
+		{
+			for (MultiLevelBucketItem * item : bucket)
+			{
+				delete item;
+			}
+
+			bucket.clear();
+		}
+
+		std::fill(this->levelSize, this->levelSize + Levels, 0);
+		this->lastKey = 0;
+		this->dataSize = 0;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	int MultiLevelBucketQueue<N, E, Levels, Radix>::digit(const unsigned long long key, const int level) const
+	{
+		return static_cast<int>((key >> (level * RadixBits)) & (Radix - 1));
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	int MultiLevelBucketQueue<N, E, Levels, Radix>::bucketIndex(const unsigned long long key) const
+	{
+		if (key == this->lastKey)
+		{
+			return this->digit(key, 0);
+		}
+
+		const int bit = BitOps::highestSetBit(key ^ this->lastKey);
+		const int level = bit / RadixBits;
+		return level < Levels ? level * Radix + this->digit(key, level) : Overflow + bit - Levels * RadixBits;
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::placeItem(MultiLevelBucketItem * item)
+	{
+		item->bucket = this->bucketIndex(item->key());
+		std::vector<MultiLevelBucketItem*> & bucket = this->buckets[item->bucket];
+		item->index = bucket.size();
+		bucket.push_back(item);
+
+		if (item->bucket < Overflow)
+		{
+			++this->levelSize[item->bucket / Radix];
+		}
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::removeFromBucket(MultiLevelBucketItem * item)
+	{
+		std::vector<MultiLevelBucketItem*> & bucket = this->buckets[item->bucket];
+		MultiLevelBucketItem * last = bucket.back();
+		bucket[item->index] = last;
+		last->index = item->index;
+		bucket.pop_back();
+
+		if (item->bucket < Overflow)
+		{
+			--this->levelSize[item->bucket / Radix];
+		}
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	auto MultiLevelBucketQueue<N, E, Levels, Radix>::minBucket() -> std::vector<MultiLevelBucketItem*> &
+	{
+		if (this->levelSize[0] == 0)
+		{
+			int level = 1;
+			while (level < Levels && this->levelSize[level] == 0)
+			{
+				++level;
+			}
+
+			if (level == Levels)
+			{
+				int bucket = Overflow;
+				while (this->buckets[bucket].empty())
+				{
+					++bucket;
+				}
+
+				this->expand(bucket);
+			}
+			else
+			{
+				// buckets below the digit of the last minimum are empty on every level
+				int bucket = level * Radix + this->digit(this->lastKey, level);
+				while (this->buckets[bucket].empty())
+				{
+					++bucket;
+				}
+
+				this->expand(bucket);
+			}
+		}
+
+		// all items on level 0 differ from the last minimum only in the lowest digit
+		int bucket = this->digit(this->lastKey, 0);
+		while (this->buckets[bucket].empty())
+		{
+			++bucket;
+		}
+
+		return this->buckets[bucket];
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::expand(const int bucketIndex)
+	{
+		std::vector<MultiLevelBucketItem*> & bucket = this->buckets[bucketIndex];
+
+		MultiLevelBucketItem * min = bucket[0];
+		for (MultiLevelBucketItem * item : bucket)
+		{
+			if (*item < *min)
+			{
+				min = item;
+			}
+		}
+
+		// every item of the bucket now differs from the new minimum on a lower level
+		this->lastKey = min->key();
+
+		if (bucketIndex < Overflow)
+		{
+			this->levelSize[bucketIndex / Radix] -= bucket.size();
+		}
+
+		std::vector<MultiLevelBucketItem*> moved;
+		moved.swap(bucket);
+
+		for (MultiLevelBucketItem * item : moved)
+		{
+			this->placeItem(item);
+		}
+
+		moved.clear();
+		moved.swap(bucket);
+	}
+
+	template<typename N, typename E, int Levels, int Radix>
+	void MultiLevelBucketQueue<N, E, Levels, Radix>::checkMonotone(N prio) const
+	{
+#ifdef _DEBUG
+		if (RadixKey<N>::toKey(prio) < this->lastKey)
+		{
+			throw std::invalid_argument("Priority must not be lower than the last extracted minimum.");
+		}
+#else
+		(void)prio;
+#endif
+	}
+
+}
\ No newline at end of file
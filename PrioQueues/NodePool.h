@@ -0,0 +1,572 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+namespace uniza_fri {
+
+	/**
+		Global counters of node allocations made by the allocation policies below.
+		Every allocator adds its counts once when it is destroyed, so the counters
+		cost nothing per allocation and can be shared by several threads.
+
+		objects           -> number of nodes created.
+		systemAllocations -> number of calls of operator new that were needed for them.
+	*/
+	class AllocationCounter
+	{
+	public:
+
+		static void add(size_t objects, size_t systemAllocations);
+		static size_t getObjectCount();
+		static size_t getSystemAllocationCount();
+		static void reset();
+
+	private:
+
+		static std::atomic<size_t> & objects();
+		static std::atomic<size_t> & systemAllocations();
+
+	};
+
+	/**
+		Allocation policy of node based heaps that allocates every node with operator new.
+
+		< Template parameters >
+
+		T -> type of the node.
+	*/
+	template<typename T>
+	class NewAllocator
+	{
+	public:
+
+		/**
+			true if releaseAll() frees all nodes at once, without destroying them one by one.
+		*/
+		static const bool BulkRelease = false;
+
+	private:
+
+		size_t created;
+
+	public:
+
+		NewAllocator();
+		NewAllocator(const NewAllocator & other) = delete;
+		NewAllocator & operator=(const NewAllocator & other) = delete;
+		~NewAllocator();
+
+		template<typename... Args>
+		T * create(Args &&... args);
+		void destroy(T * node);
+		void releaseAll();
+		void absorb(NewAllocator & other);
+		void reserve(size_t n);
+
+	};
+
+	/**
+		Allocation policy of node based heaps that carves nodes out of chunks
+		of ChunkSize nodes. Destroyed nodes go to a free list and are reused by create.
+
+		releaseAll() makes all chunks free again in O(1) without calling destructors
+		of the nodes, so the heap may use it only if destructors of its nodes do nothing
+		important (element and priority are trivially destructible). The chunks
+		themselves are kept for the next use and returned to the system in the destructor.
+
+		< Template parameters >
+
+		T -> type of the node.
+	*/
+	template<typename T>
+	class PoolAllocator
+	{
+	public:
+
+		static const bool BulkRelease = true;
+
+	private:
+
+		static const size_t ChunkSize = 256;
+
+		union Slot
+		{
+			Slot * next;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+		};
+
+	private:
+
+		std::vector<Slot*> chunks;
+		size_t currentChunk;
+		size_t usedInChunk;
+		Slot * freeList;
+		size_t created;
+		size_t chunksAllocated;
+
+	public:
+
+		PoolAllocator();
+		PoolAllocator(const PoolAllocator & other) = delete;
+		PoolAllocator & operator=(const PoolAllocator & other) = delete;
+		~PoolAllocator();
+
+		template<typename... Args>
+		T * create(Args &&... args);
+		void destroy(T * node);
+		void releaseAll();
+
+		/**
+			Allocates chunks in advance so that next n nodes do not need new chunk.
+		*/
+		void reserve(size_t n);
+
+		/**
+			Takes over all chunks of other (nodes living in them are moved
+			to this heap by meld). other is left without any chunk.
+		*/
+		void absorb(PoolAllocator & other);
+
+	private:
+
+		Slot * nextSlot();
+
+	};
+
+	/**
+		Pool of nodes addressed by 32 bit indices, for heaps that link their nodes
+		by indices instead of pointers. Like PoolAllocator it carves nodes out of chunks,
+		so nodes never move and pointers to them stay valid as well.
+		Destroyed nodes go to a free list and are reused by create.
+		releaseAll() has the same restrictions as the one of PoolAllocator.
+
+		< Template parameters >
+
+		T         -> type of the node.
+		ChunkBits -> binary logarithm of the number of nodes in one chunk.
+	*/
+	template<typename T, int ChunkBits = 10>
+	class IndexPool
+	{
+	public:
+
+		typedef uint32_t index_t;
+
+		static const bool BulkRelease = true;
+		static const index_t Null = 0xFFFFFFFF;
+
+	private:
+
+		static const index_t ChunkSize = static_cast<index_t>(1) << ChunkBits;
+
+		union Slot
+		{
+			index_t next;
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+		};
+
+	private:
+
+		std::vector<Slot*> chunks;
+		index_t carved;
+		index_t freeList;
+		size_t created;
+		size_t chunksAllocated;
+
+	public:
+
+		IndexPool();
+		IndexPool(const IndexPool & other) = delete;
+		IndexPool & operator=(const IndexPool & other) = delete;
+		~IndexPool();
+
+		template<typename... Args>
+		index_t create(Args &&... args);
+		void destroy(index_t index);
+		T & operator[](index_t index);
+		const T & operator[](index_t index) const;
+		void releaseAll();
+
+		/**
+			Allocates chunks in advance so that next n nodes do not need new chunk.
+		*/
+		void reserve(size_t n);
+
+		/**
+			Takes over all chunks of other. Nodes of other keep their addresses,
+			but their indices grow by the returned offset, so the heap has to shift
+			all indices stored in them. other is left without any chunk.
+		*/
+		index_t absorb(IndexPool & other);
+
+	private:
+
+		Slot & slot(index_t index);
+		const Slot & slot(index_t index) const;
+
+	};
+
+	/**
+		@return true if nodes of allocator A holding priority N and element E can be freed
+				by A::releaseAll() without calling their destructors one by one.
+	*/
+	template<typename A, typename N, typename E>
+	constexpr bool canReleaseAll()
+	{
+		return A::BulkRelease && std::is_trivially_destructible<N>::value && std::is_trivially_destructible<E>::value;
+	}
+
+	//
+	// AllocationCounter
+	//
+	inline void AllocationCounter::add(const size_t pObjects, const size_t pSystemAllocations)
+	{
+		objects() += pObjects;
+		systemAllocations() += pSystemAllocations;
+	}
+
+	inline size_t AllocationCounter::getObjectCount()
+	{
+		return objects();
+	}
+
+	inline size_t AllocationCounter::getSystemAllocationCount()
+	{
+		return systemAllocations();
+	}
+
+	inline void AllocationCounter::reset()
+	{
+		objects() = 0;
+		systemAllocations() = 0;
+	}
+
+	inline std::atomic<size_t> & AllocationCounter::objects()
+	{
+		static std::atomic<size_t> counter(0);
+		return counter;
+	}
+
+	inline std::atomic<size_t> & AllocationCounter::systemAllocations()
+	{
+		static std::atomic<size_t> counter(0);
+		return counter;
+	}
+
+	//
+	// NewAllocator
+	//
+	template<typename T>
+	NewAllocator<T>::NewAllocator() :
+		created(0)
+	{
+	}
+
+	template<typename T>
+	NewAllocator<T>::~NewAllocator()
+	{
+		AllocationCounter::add(this->created, this->created);
+	}
+
+	template<typename T>
+	template<typename... Args>
+	T * NewAllocator<T>::create(Args &&... args)
+	{
+		++this->created;
+		return new T(std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	void NewAllocator<T>::destroy(T * node)
+	{
+		delete node;
+	}
+
+	template<typename T>
+	void NewAllocator<T>::releaseAll()
+	{
+	}
+
+	template<typename T>
+	void NewAllocator<T>::absorb(NewAllocator &)
+	{
+	}
+
+	template<typename T>
+	void NewAllocator<T>::reserve(size_t)
+	{
+	}
+
+	//
+	// PoolAllocator
+	//
+	template<typename T>
+	PoolAllocator<T>::PoolAllocator() :
+		currentChunk(0),
+		usedInChunk(0),
+		freeList(nullptr),
+		created(0),
+		chunksAllocated(0)
+	{
+	}
+
+	template<typename T>
+	PoolAllocator<T>::~PoolAllocator()
+	{
+		for (Slot * chunk : this->chunks)
+		{
+			delete[] chunk;
+		}
+
+		AllocationCounter::add(this->created, this->chunksAllocated);
+	}
+
+	template<typename T>
+	template<typename... Args>
+	T * PoolAllocator<T>::create(Args &&... args)
+	{
+		++this->created;
+		return new (&this->nextSlot()->storage) T(std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	void PoolAllocator<T>::destroy(T * node)
+	{
+		node->~T();
+
+		Slot * slot = reinterpret_cast<Slot*>(node);
+		slot->next = this->freeList;
+		this->freeList = slot;
+	}
+
+	template<typename T>
+	void PoolAllocator<T>::releaseAll()
+	{
+		this->freeList = nullptr;
+		this->currentChunk = 0;
+		this->usedInChunk = 0;
+	}
+
+	template<typename T>
+	void PoolAllocator<T>::absorb(PoolAllocator & other)
+	{
+		if (other.chunks.empty())
+		{
+			return;
+		}
+
+		// chunks of other are put before the current chunk, so they are never carved again,
+		// their free slots are reachable through the joined free list
+		this->chunks.insert(this->chunks.begin(), other.chunks.begin(), other.chunks.end());
+		this->currentChunk += other.chunks.size();
+
+		// slots of other that were not carved yet (rest of its current chunk and reserved chunks) are freed too,
+		// otherwise every meld would leave them unused for good
+		for (size_t chunk = other.currentChunk; chunk < other.chunks.size(); chunk++)
+		{
+			const size_t firstFree = chunk == other.currentChunk ? other.usedInChunk : 0;
+
+			for (size_t i = firstFree; i < ChunkSize; i++)
+			{
+				Slot * slot = &other.chunks[chunk][i];
+				slot->next = this->freeList;
+				this->freeList = slot;
+			}
+		}
+
+		if (other.freeList)
+		{
+			Slot * last = other.freeList;
+			while (last->next)
+			{
+				last = last->next;
+			}
+
+			last->next = this->freeList;
+			this->freeList = other.freeList;
+		}
+
+		other.chunks.clear();
+		other.releaseAll();
+	}
+
+	template<typename T>
+	void PoolAllocator<T>::reserve(const size_t n)
+	{
+		// slots of the current chunk that were not carved yet plus all chunks after it
+		size_t available = this->chunks.size() > this->currentChunk
+			? (this->chunks.size() - this->currentChunk) * ChunkSize - this->usedInChunk
+			: 0;
+
+		while (available < n)
+		{
+			this->chunks.push_back(new Slot[ChunkSize]);
+			++this->chunksAllocated;
+			available += ChunkSize;
+		}
+	}
+
+	template<typename T>
+	auto PoolAllocator<T>::nextSlot() -> Slot *
+	{
+		if (this->freeList)
+		{
+			Slot * slot = this->freeList;
+			this->freeList = slot->next;
+			return slot;
+		}
+
+		if (this->currentChunk < this->chunks.size() && this->usedInChunk == ChunkSize)
+		{
+			++this->currentChunk;
+			this->usedInChunk = 0;
+		}
+
+		if (this->currentChunk == this->chunks.size())
+		{
+			this->chunks.push_back(new Slot[ChunkSize]);
+			++this->chunksAllocated;
+			this->usedInChunk = 0;
+		}
+
+		return &this->chunks[this->currentChunk][this->usedInChunk++];
+	}
+
+	//
+	// IndexPool
+	//
+	template<typename T, int ChunkBits>
+	IndexPool<T, ChunkBits>::IndexPool() :
+		carved(0),
+		freeList(Null),
+		created(0),
+		chunksAllocated(0)
+	{
+	}
+
+	template<typename T, int ChunkBits>
+	IndexPool<T, ChunkBits>::~IndexPool()
+	{
+		for (Slot * chunk : this->chunks)
+		{
+			delete[] chunk;
+		}
+
+		AllocationCounter::add(this->created, this->chunksAllocated);
+	}
+
+	template<typename T, int ChunkBits>
+	template<typename... Args>
+	auto IndexPool<T, ChunkBits>::create(Args &&... args) -> index_t
+	{
+		index_t index;
+
+		if (this->freeList != Null)
+		{
+			index = this->freeList;
+			this->freeList = this->slot(index).next;
+		}
+		else
+		{
+			if (this->carved == this->chunks.size() * ChunkSize)
+			{
+				this->chunks.push_back(new Slot[ChunkSize]);
+				++this->chunksAllocated;
+			}
+
+			index = this->carved++;
+		}
+
+		++this->created;
+		new (&this->slot(index).storage) T(std::forward<Args>(args)...);
+
+		return index;
+	}
+
+	template<typename T, int ChunkBits>
+	void IndexPool<T, ChunkBits>::destroy(const index_t index)
+	{
+		(*this)[index].~T();
+
+		this->slot(index).next = this->freeList;
+		this->freeList = index;
+	}
+
+	template<typename T, int ChunkBits>
+	T & IndexPool<T, ChunkBits>::operator[](const index_t index)
+	{
+		return *reinterpret_cast<T*>(&this->slot(index).storage);
+	}
+
+	template<typename T, int ChunkBits>
+	const T & IndexPool<T, ChunkBits>::operator[](const index_t index) const
+	{
+		return *reinterpret_cast<const T*>(&this->slot(index).storage);
+	}
+
+	template<typename T, int ChunkBits>
+	void IndexPool<T, ChunkBits>::releaseAll()
+	{
+		this->carved = 0;
+		this->freeList = Null;
+	}
+
+	template<typename T, int ChunkBits>
+	void IndexPool<T, ChunkBits>::reserve(const size_t n)
+	{
+		while (this->chunks.size() * ChunkSize - this->carved < n)
+		{
+			this->chunks.push_back(new Slot[ChunkSize]);
+			++this->chunksAllocated;
+		}
+	}
+
+	template<typename T, int ChunkBits>
+	auto IndexPool<T, ChunkBits>::absorb(IndexPool & other) -> index_t
+	{
+		const index_t offset = static_cast<index_t>(this->chunks.size() * ChunkSize);
+
+		// carving continues in the chunks of other, slots of this pool that were not carved yet are freed
+		for (index_t index = this->carved; index < offset; index++)
+		{
+			this->slot(index).next = this->freeList;
+			this->freeList = index;
+		}
+
+		this->chunks.insert(this->chunks.end(), other.chunks.begin(), other.chunks.end());
+
+		index_t otherFree = other.freeList;
+		while (otherFree != Null)
+		{
+			const index_t index = otherFree + offset;
+			otherFree = this->slot(index).next;
+
+			this->slot(index).next = this->freeList;
+			this->freeList = index;
+		}
+
+		this->carved = offset + other.carved;
+
+		other.chunks.clear();
+		other.releaseAll();
+
+		return offset;
+	}
+
+	template<typename T, int ChunkBits>
+	auto IndexPool<T, ChunkBits>::slot(const index_t index) -> Slot &
+	{
+		return this->chunks[index >> ChunkBits][index & (ChunkSize - 1)];
+	}
+
+	template<typename T, int ChunkBits>
+	auto IndexPool<T, ChunkBits>::slot(const index_t index) const -> const Slot &
+	{
+		return this->chunks[index >> ChunkBits][index & (ChunkSize - 1)];
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <stdexcept>
+
+#include "PriorityQueue.h"
+
+namespace uniza_fri {
+
+	/**
+		Pairing strategies of PairingHeap used when the children of the deleted root are combined.
+		two_pass_pairing  -> pairs children left to right, then melds the pairs right to left.
+		multipass_pairing -> repeatedly pairs the first two trees and appends the result to the end.
+	*/
+	struct two_pass_pairing {};
+	struct multipass_pairing {};
+
+	/**
+		< Complexities >
+
+		insert		-> O(1)
+		findMin		-> O(1)
+		decreaseKey	-> O(log n) amortized, o(log n) conjectured
+		meld		-> O(1)
+		deleteMin	-> O(log n) amortized
+
+		< Template parameters >
+
+		Pairing -> two_pass_pairing or multipass_pairing.
+		Order   -> ordering policy (MinOrder, MaxOrder).
+
+		Heap ordered multiway tree stored as a binary tree (first child, next sibling).
+		Every node keeps a pointer to its previous sibling, the first child keeps
+		a pointer to its parent instead, so decreaseKey can cut a subtree in O(1).
+	*/
+	template<typename N, typename E, typename Pairing = two_pass_pairing, typename Order = MinOrder<N>>
+	class PairingHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class PairingHeapNode;
+
+	private:
+
+		size_t dataSize;
+		PairingHeapNode * root;
+		std::vector<PairingHeapNode*> trees;
+
+	public:
+
+		typedef PairingHeapNode entry_t;
+
+		PairingHeap();
+		virtual ~PairingHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+
+	private:
+
+		PairingHeapNode * link(PairingHeapNode * first, PairingHeapNode * second);
+		PairingHeapNode * combineChildren(PairingHeapNode * firstChild);
+		PairingHeapNode * combineTrees(two_pass_pairing);
+		PairingHeapNode * combineTrees(multipass_pairing);
+
+	private:
+
+		class PairingHeapNode : public QueueEntry<N, E>
+		{
+		public:
+
+			PairingHeapNode * child;
+			PairingHeapNode * prev;
+			PairingHeapNode * next;
+
+			PairingHeapNode(E pData, N pPrio);
+			~PairingHeapNode() = default;
+			void setPrio(N newPrio);
+			void cut();
+
+		};
+
+	};
+
+	//
+	// PairingHeapNode
+	//
+	template<typename N, typename E, typename Pairing, typename Order>
+	PairingHeap<N, E, Pairing, Order>::PairingHeapNode::PairingHeapNode(E pData, N pPrio) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		child(nullptr),
+		prev(nullptr),
+		next(nullptr)
+	{
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	void PairingHeap<N, E, Pairing, Order>::PairingHeapNode::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	void PairingHeap<N, E, Pairing, Order>::PairingHeapNode::cut()
+	{
+		if (this->prev->child == this)
+		{
+			this->prev->child = this->next;
+		}
+		else
+		{
+			this->prev->next = this->next;
+		}
+
+		if (this->next)
+		{
+			this->next->prev = this->prev;
+		}
+
+		this->prev = nullptr;
+		this->next = nullptr;
+	}
+
+	//
+	// PairingHeap
+	//
+	template<typename N, typename E, typename Pairing, typename Order>
+	PairingHeap<N, E, Pairing, Order>::PairingHeap() :
+		dataSize(0),
+		root(nullptr)
+	{
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	PairingHeap<N, E, Pairing, Order>::~PairingHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	QueueEntry<N, E> * PairingHeap<N, E, Pairing, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	QueueEntry<N, E> * PairingHeap<N, E, Pairing, Order>::insert(E && data, N prio)
+	{
+		auto * newNode = new PairingHeapNode(std::move(data), prio);
+
+		this->root = this->root ? this->link(this->root, newNode) : newNode;
+		++this->dataSize;
+
+		return newNode;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	void PairingHeap<N, E, Pairing, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	void PairingHeap<N, E, Pairing, Order>::decreaseKey(entry_t & entry, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(entry, newPrio);
+
+		auto * node = &entry;
+		node->setPrio(newPrio);
+
+		if (node != this->root)
+		{
+			node->cut();
+			this->root = this->link(this->root, node);
+		}
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	PriorityQueue<N, E> * PairingHeap<N, E, Pairing, Order>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherPairing = dynamic_cast<PairingHeap<N, E, Pairing, Order> *>(other);
+
+		if (!otherPairing)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		if (otherPairing->root)
+		{
+			this->root = this->root ? this->link(this->root, otherPairing->root) : otherPairing->root;
+		}
+
+		this->dataSize += otherPairing->dataSize;
+
+		otherPairing->dataSize = 0;
+		otherPairing->root = nullptr;
+
+		return this;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	std::pair<E, N> PairingHeap<N, E, Pairing, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		PairingHeapNode * poped = this->root;
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+
+		this->root = this->combineChildren(poped->child);
+		--this->dataSize;
+		delete poped;
+
+		return popedData;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	E PairingHeap<N, E, Pairing, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	E & PairingHeap<N, E, Pairing, Order>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->root->getData();
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	size_t PairingHeap<N, E, Pairing, Order>::size()
+	{
+		return this->dataSize;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	void PairingHeap<N, E, Pairing, Order>::clear()
+	{
+		// the tree can be as deep as the number of nodes, so it is not deleted recursively
+		std::vector<PairingHeapNode*> stack;
+
+		if (this->root)
+		{
+			stack.push_back(this->root);
+		}
+
+		while (!stack.empty())
+		{
+			PairingHeapNode * node = stack.back();
+			stack.pop_back();
+
+			if (node->child) stack.push_back(node->child);
+			if (node->next) stack.push_back(node->next);
+
+			delete node;
+		}
+
+		this->root = nullptr;
+		this->dataSize = 0;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	auto PairingHeap<N, E, Pairing, Order>::link(PairingHeapNode * first, PairingHeapNode * second) -> PairingHeapNode *
+	{
+		if (Order::before(second->getPrio(), first->getPrio()))
+		{
+			std::swap(first, second);
+		}
+
+		second->prev = first;
+		second->next = first->child;
+
+		if (first->child)
+		{
+			first->child->prev = second;
+		}
+
+		first->child = second;
+
+		return first;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	auto PairingHeap<N, E, Pairing, Order>::combineChildren(PairingHeapNode * firstChild) -> PairingHeapNode *
+	{
+		if (!firstChild)
+		{
+			return nullptr;
+		}
+
+		for (PairingHeapNode * it = firstChild; it; )
+		{
+			PairingHeapNode * nextIt = it->next;
+			it->prev = nullptr;
+			it->next = nullptr;
+			this->trees.push_back(it);
+			it = nextIt;
+		}
+
+		PairingHeapNode * newRoot = this->combineTrees(Pairing());
+		this->trees.clear();
+
+		return newRoot;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	auto PairingHeap<N, E, Pairing, Order>::combineTrees(two_pass_pairing) -> PairingHeapNode *
+	{
+		const size_t count = this->trees.size();
+
+		size_t pairCount = 0;
+		for (size_t i = 0; i + 1 < count; i += 2)
+		{
+			this->trees[pairCount++] = this->link(this->trees[i], this->trees[i + 1]);
+		}
+
+		if (count % 2 == 1)
+		{
+			this->trees[pairCount++] = this->trees[count - 1];
+		}
+
+		PairingHeapNode * result = this->trees[pairCount - 1];
+		for (size_t i = pairCount - 1; i > 0; i--)
+		{
+			result = this->link(this->trees[i - 1], result);
+		}
+
+		return result;
+	}
+
+	template<typename N, typename E, typename Pairing, typename Order>
+	auto PairingHeap<N, E, Pairing, Order>::combineTrees(multipass_pairing) -> PairingHeapNode *
+	{
+		// trees are used as a FIFO queue, result of every pairing is appended to the end
+		size_t first = 0;
+		while (first + 1 < this->trees.size())
+		{
+			this->trees.push_back(this->link(this->trees[first], this->trees[first + 1]));
+			first += 2;
+		}
+
+		return this->trees[first];
+	}
+
+}
\ No newline at end of file
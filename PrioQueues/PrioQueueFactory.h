@@ -1,13 +1,25 @@
 #pragma once
 
 #include "JustListPrioQueue.h"
+#include "SimdListPrioQueue.h"
 #include "BinaryHeap.h"
 #include "BinomialHeap.h"
+#include "ImplicitBinomialHeap.h"
 #include "FibonacciHeap.h"
+#include "IndexedFibonacciHeap.h"
 #include "BrodalQueue.h"
 #include "StrictFibonacciHeap.h"
-#include "BoostFibHeap.h"
+#include "BoostHeap.h"
 #include "StlBinaryHeap.h"
+#include "RadixHeap.h"
+#include "DaryHeap.h"
+#include "PairingHeap.h"
+#include "BucketQueue.h"
+#include "MultiLevelBucketQueue.h"
+#include "IntrusiveBinaryHeap.h"
+#include "HybridQueue.h"
+
+#include <type_traits>
 
 namespace uniza_fri {
 
@@ -15,16 +27,42 @@ namespace uniza_fri {
 	class brodal_queue {};
 	class binomial_heap {};
 	class boost_fibonacci_heap {};
+	class boost_pairing_heap {};
+	class boost_binomial_heap {};
+	class boost_skew_heap {};
+	template<int D> class boost_d_ary_heap {};
 	class fibonacci_heap {};
+	class pooled_fibonacci_heap {};
+	class indexed_fibonacci_heap {};
+	class pooled_binomial_heap {};
+	class lazy_binomial_heap {};
+	class implicit_binomial_heap {};
 	class just_list_queue {};
+	class simd_list_queue {};
 	class stl_binary_heap {};
+	class lazy_stl_binary_heap {};
 	class strict_fibonacci_heap {};
+	class radix_heap {};
+	template<int D> class dary_heap {};
+	class pairing_heap {};
+	class multipass_pairing_heap {};
+	class bucket_queue {};
+	template<int Levels, int Radix> class multilevel_bucket_queue {};
+	class intrusive_binary_heap {};
+	template<int Threshold> class hybrid_queue {};
+	class auto_queue {};
 
 	/*
 		Tovre na vrobu prioritnch frontov rznych druhov.
 		Pre konkrtne hodnoty parametra T (deklarovan nad touto triedou)
 		je tto ablnov trieda pecializovan tak, aby metda makeQueue
 		vracala intanciu konkrtneho prioritnho frontu poda parametra.
+
+		ablna queue_t je konkrtny typ frontu. Dijkstra si ho dr priamo
+		(nie cez PriorityQueue), take volania frontu nie s virtulne a mu
+		sa inlinova. Okrem rozhrania PriorityQueue mus takto front poskytova
+		typ entry_t (typ poloky vrtenej z insert) a decreaseKey(entry_t &, N),
+		ktor poloku nepretypovva cez dynamic_cast.
 	 */
 	template<class T>
 	class Factory
@@ -37,81 +75,398 @@ namespace uniza_fri {
 	template<> class Factory<just_list_queue>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = JustListPrioQueue<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<simd_list_queue>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = SimdListPrioQueue<N, E>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new JustListPrioQueue<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<binary_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = BinaryHeap<N, E>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new BinaryHeap<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<binomial_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = BinomialHeap<N, E>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new BinomialHeap<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<fibonacci_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = FibonacciHeap<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<pooled_binomial_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BinomialHeap<N, E, PoolAllocator>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<lazy_binomial_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BinomialHeap<N, E, NewAllocator, true>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<implicit_binomial_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = ImplicitBinomialHeap<N, E, PoolAllocator>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new FibonacciHeap<N, E>();
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<pooled_fibonacci_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = FibonacciHeap<N, E, PoolAllocator>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<indexed_fibonacci_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = IndexedFibonacciHeap<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<brodal_queue>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = BrodalQueue<N, E>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new BrodalQueue<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<strict_fibonacci_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = StrictFibonacciHeap<N, E>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new StrictFibonacciHeap<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<boost_fibonacci_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = BoostHeap<N, E, boost_fibonacci>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<boost_pairing_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BoostHeap<N, E, boost_pairing>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<boost_binomial_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BoostHeap<N, E, boost_binomial>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<boost_skew_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BoostHeap<N, E, boost_skew>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<int D> class Factory<boost_d_ary_heap<D>>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BoostHeap<N, E, boost_d_ary<D>>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new BoostFibHeap<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
 	template<> class Factory<stl_binary_heap>
 	{
 	public:
+		template<class N, class E>
+		using queue_t = StlBinaryHeap<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	/*
+		Front bez decreaseKey, Dijkstra s nm pouva leniv mazanie
+		(vrchol sa vlo znova a staria kpia sa pri vbere presko).
+		Namiesto queue_t a makeQueue poskytuje ablnu lazy_t.
+	 */
+	template<> class Factory<lazy_stl_binary_heap>
+	{
+	public:
+		template<class N>
+		using lazy_t = StlLazyBinaryHeap<N>;
+	};
+
+	template<> class Factory<radix_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = RadixHeap<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<int D> class Factory<dary_heap<D>>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = DaryHeap<N, E, D>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<pairing_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = PairingHeap<N, E, two_pass_pairing>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<> class Factory<multipass_pairing_heap>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = PairingHeap<N, E, multipass_pairing>;
+
 		template<class N, class E>
 		static PriorityQueue<N, E> * makeQueue()
 		{
-			return new StlBinaryHeap<N, E>();
+			return new queue_t<N, E>();
 		}
 	};
 
+	/*
+		Dialov front m by vek poda maximlnej ceny hrany grafu (viz. has_bounded_span),
+		preto m aj makeQueue s touto cenou. Bez nej si front rozsah kov odvodzuje sm.
+	 */
+	template<> class Factory<bucket_queue>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = BucketQueue<N, E>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue(const size_t maxArcCost)
+		{
+			return new queue_t<N, E>(maxArcCost);
+		}
+	};
+
+	template<int Levels, int Radix> class Factory<multilevel_bucket_queue<Levels, Radix>>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = MultiLevelBucketQueue<N, E, Levels, Radix>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	template<int Threshold> class Factory<hybrid_queue<Threshold>>
+	{
+	public:
+		template<class N, class E>
+		using queue_t = HybridQueue<N, E, Threshold>;
+
+		template<class N, class E>
+		static PriorityQueue<N, E> * makeQueue()
+		{
+			return new queue_t<N, E>();
+		}
+	};
+
+	/*
+		Intrzivny front nie je PriorityQueue, pozcie prvkov si uklad do zznamov
+		vrcholov (PositionMap), preto namiesto queue_t a makeQueue poskytuje ablnu intrusive_t.
+	 */
+	template<> class Factory<intrusive_binary_heap>
+	{
+	public:
+		template<class N, class PositionMap>
+		using intrusive_t = IntrusiveBinaryHeap<N, PositionMap>;
+	};
+
+	/*
+		Uruje, i dan druh frontu je intrzivny (Factory<T>::intrusive_t).
+	 */
+	template<typename T>
+	struct is_intrusive_queue : std::false_type {};
+
+	template<>
+	struct is_intrusive_queue<intrusive_binary_heap> : std::true_type {};
+
+	/*
+		Uruje, i dan druh frontu vie zni k. Pre druhy bez decreaseKey
+		(Factory<T>::lazy_t) Dijkstra pouije relaxciu s lenivm mazanm.
+	 */
+	template<typename T>
+	struct has_decrease_key : std::true_type {};
+
+	template<>
+	struct has_decrease_key<lazy_stl_binary_heap> : std::false_type {};
+
+	/*
+		Uruje, i front vyber a Dijkstra poda kalibrcie na danom grafe (viz. trieda AutoQueue).
+	 */
+	template<typename T>
+	struct is_auto_queue : std::false_type {};
+
+	template<>
+	struct is_auto_queue<auto_queue> : std::true_type {};
+
+	/*
+		Uruje, i ke vo fronte sm by od minima vzdialen najviac o maximlnu cenu hrany
+		(Dialov front). Dijkstra tak front vytvra s maximlnou cenou hrany grafu
+		a ned sa poui v pointToAllBasic, ktor vklad vrcholy s nekonenou vzdialenosou.
+	 */
+	template<typename T>
+	struct has_bounded_span : std::false_type {};
+
+	template<>
+	struct has_bounded_span<bucket_queue> : std::true_type {};
+
 }
\ No newline at end of file
@@ -1,13 +1,45 @@
 #pragma once
 
+#include <utility>
+
 namespace uniza_fri {
 
+	/**
+		Ordering policies of priority queues. Queues that take one as a template
+		parameter compare priorities only through Order::before, so the comparison
+		is resolved at compile time and inlined.
+		before(a, b) is true if priority a leaves the queue before priority b.
+
+		MinOrder -> smaller value means higher priority (default).
+		MaxOrder -> bigger value means higher priority, e.g. for widest path search.
+	*/
+	template<typename N>
+	struct MinOrder
+	{
+		static bool before(const N & a, const N & b);
+	};
+
+	template<typename N>
+	struct MaxOrder
+	{
+		static bool before(const N & a, const N & b);
+	};
+
+	/**
+		Tag of the constructors of QueueEntry and of queue nodes that construct
+		the element in place from the arguments following the priority (see PriorityQueue::emplace).
+	*/
+	struct emplace_tag {};
+
 	/**
 		< Template parameters >
 
 		N -> Priority comparable with operator<(). 
-			 Smaller value means higher priority.
+			 Smaller value means higher priority unless the queue takes an ordering policy.
 		E -> element type
+
+		Plain record without virtual methods, queues derive their items from it
+		but never delete them through a pointer to QueueEntry.
 	*/
 
 	template<typename N, typename E>
@@ -19,10 +51,12 @@ namespace uniza_fri {
 
 	public:
 		QueueEntry(const E & pData, N pPrio);
-		virtual ~QueueEntry() = default;
+		QueueEntry(E && pData, N pPrio);
+		template<typename... Args>
+		QueueEntry(emplace_tag, N pPrio, Args &&... args);
 		E & getData();
 		N getPrio() const;
-		virtual bool operator<(const QueueEntry<N, E> & other);
+		bool operator<(const QueueEntry<N, E> & other) const;
 
 	protected:
 		void setPrioInternal(N newPrio);
@@ -42,6 +76,34 @@ namespace uniza_fri {
 			@param  prio Priority of inserted element.
 		*/
 		virtual QueueEntry<N, E> * insert(const E & data, N prio) = 0;
+
+		/**
+			Same as insert but moves data into the queue instead of copying it.
+		*/
+		virtual QueueEntry<N, E> * insert(E && data, N prio) = 0;
+
+		/**
+			Inserts an element constructed from args. This version constructs a temporary
+			and moves it into the queue by insert(E &&). Queues whose nodes come from an allocator
+			(FibonacciHeap, BinomialHeap, IndexedFibonacciHeap) hide it with their own version,
+			which constructs the element right in the node and is used when the queue is called through its own type.
+
+			@return Same as insert.
+			@param  prio Priority of inserted element. It goes first since a parameter pack must be last.
+		*/
+		template<typename... Args>
+		QueueEntry<N, E> * emplace(N prio, Args &&... args);
+
+		/**
+			Inserts all elements of the range [first, last) of std::pair<E, N> (element, priority).
+			This version just calls insert for each of them. Queues that can be built faster
+			hide it with their own version, which is used when the queue is called through its own type.
+
+			@return Output iterator one past the last written entry.
+			@param  out Receives QueueEntry pointer of each inserted element in the order of the range.
+		*/
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
 		
 		/**
 			@param entry   QueueEntry pointer associated with element whose priority it to be increased.
@@ -66,6 +128,14 @@ namespace uniza_fri {
 		*/
 		virtual E deleteMin() = 0;
 
+		/**
+			Removes element with highest priority from queue and moves it out together with its priority.
+			Throws std::out_of_range if queue is empty.
+
+			@return Pair of the element with highest priority and its priority.
+		*/
+		virtual std::pair<E, N> popMin() = 0;
+
 		/**
 			Throws std::out_of_range if queue is empty.
 
@@ -83,6 +153,13 @@ namespace uniza_fri {
 		*/
 		virtual void clear() = 0;
 
+		/**
+			Hint that the queue will hold up to n elements. Queues that can allocate
+			their storage in advance do it here, the others ignore it.
+			clear() keeps storage allocated this way.
+		*/
+		virtual void reserve(size_t n);
+
 		/**
 			@return true if size() == 0, otherwise false
 		*/
@@ -90,10 +167,26 @@ namespace uniza_fri {
 
 	protected:
 
+		template<typename Order = MinOrder<N>>
 		static void decKeyLogicCheck(QueueEntry<N, E> & entry, N newPrio);
 
 	};
 
+	//
+	// MinOrder, MaxOrder
+	//
+	template<typename N>
+	bool MinOrder<N>::before(const N & a, const N & b)
+	{
+		return a < b;
+	}
+
+	template<typename N>
+	bool MaxOrder<N>::before(const N & a, const N & b)
+	{
+		return b < a;
+	}
+
 	//
 	// QueueEntry
 	//
@@ -104,6 +197,21 @@ namespace uniza_fri {
 	{
 	}
 
+	template<typename N, typename E>
+	QueueEntry<N, E>::QueueEntry(E && pdata, N pprio) :
+		data(std::move(pdata)),
+		prio(pprio)
+	{
+	}
+
+	template<typename N, typename E>
+	template<typename... Args>
+	QueueEntry<N, E>::QueueEntry(emplace_tag, N pprio, Args &&... args) :
+		data(std::forward<Args>(args)...),
+		prio(pprio)
+	{
+	}
+
 	template<typename N, typename E>
 	E & QueueEntry<N, E>::getData()
 	{
@@ -117,7 +225,7 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename E>
-	bool QueueEntry<N, E>::operator<(const QueueEntry<N, E>& other)
+	bool QueueEntry<N, E>::operator<(const QueueEntry<N, E>& other) const
 	{
 		return this->prio < other.prio;
 	}
@@ -131,6 +239,30 @@ namespace uniza_fri {
 	//
 	// PriorityQueue
 	//
+	template<typename N, typename E>
+	template<typename... Args>
+	QueueEntry<N, E> * PriorityQueue<N, E>::emplace(N prio, Args &&... args)
+	{
+		return this->insert(E(std::forward<Args>(args)...), prio);
+	}
+
+	template<typename N, typename E>
+	template<typename InputIt, typename OutputIt>
+	OutputIt PriorityQueue<N, E>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		for (; first != last; ++first)
+		{
+			*out++ = this->insert(first->first, first->second);
+		}
+
+		return out;
+	}
+
+	template<typename N, typename E>
+	void PriorityQueue<N, E>::reserve(size_t)
+	{
+	}
+
 	template<typename N, typename E>
 	bool PriorityQueue<N, E>::isEmpty()
 	{
@@ -138,9 +270,10 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename E>
+	template<typename Order>
 	void PriorityQueue<N, E>::decKeyLogicCheck(QueueEntry<N, E>& entry, N newPrio)
 	{
-		if (newPrio > entry.getPrio())
+		if (Order::before(entry.getPrio(), newPrio))
 		{
 			throw std::invalid_argument("New value of the priority must be lower or equal than current value.");
 		}
@@ -0,0 +1,392 @@
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PriorityQueue.h"
+#include "BitOps.h"
+
+namespace uniza_fri {
+
+	/**
+		Maps priority to an unsigned integer key so that the order of priorities is preserved.
+		Unsigned integers map to themselves, signed integers get their sign bit flipped
+		and floating point numbers are mapped by their IEEE 754 bit pattern
+		(negative numbers get all bits flipped, positive numbers only the sign bit).
+	*/
+	template<typename N, typename Enable = void>
+	struct RadixKey;
+
+	template<typename N>
+	struct RadixKey<N, typename std::enable_if<std::is_integral<N>::value && std::is_unsigned<N>::value>::type>
+	{
+		static unsigned long long toKey(N prio)
+		{
+			return static_cast<unsigned long long>(prio);
+		}
+	};
+
+	template<typename N>
+	struct RadixKey<N, typename std::enable_if<std::is_integral<N>::value && std::is_signed<N>::value>::type>
+	{
+		static unsigned long long toKey(N prio)
+		{
+			return static_cast<unsigned long long>(static_cast<long long>(prio)) ^ (1ULL << 63);
+		}
+	};
+
+	template<>
+	struct RadixKey<float>
+	{
+		static unsigned long long toKey(float prio)
+		{
+			unsigned int bits;
+			std::memcpy(&bits, &prio, sizeof(bits));
+			return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+		}
+	};
+
+	template<>
+	struct RadixKey<double>
+	{
+		static unsigned long long toKey(double prio)
+		{
+			unsigned long long bits;
+			std::memcpy(&bits, &prio, sizeof(bits));
+			return (bits & (1ULL << 63)) ? ~bits : (bits | (1ULL << 63));
+		}
+	};
+
+	/**
+		< Complexities >
+
+		insert		-> O(1)
+		findMin		-> O(1) amortized
+		decreaseKey	-> O(1)
+		meld		-> O(n + m)
+		deleteMin	-> O(lg C) amortized, C is the key range
+
+		Monotone priority queue. Elements are kept in buckets by the highest bit
+		in which their key differs from the key of the last extracted minimum,
+		so priorities inserted or decreased must never be lower than the last
+		extracted one, which is always true in Dijkstra's algorithm.
+		Throws std::invalid_argument otherwise. When the queue becomes empty
+		the restriction is lifted.
+	*/
+	template<typename N, typename E>
+	class RadixHeap final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class RadixHeapItem;
+
+		static const int BucketCount = 65;
+
+	private:
+
+		std::vector<RadixHeapItem*> buckets[BucketCount];
+		unsigned long long lastKey;
+		size_t dataSize;
+
+	public:
+
+		typedef RadixHeapItem entry_t;
+
+		RadixHeap();
+		virtual ~RadixHeap();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+
+	private:
+
+		int bucketIndex(unsigned long long key) const;
+		void placeItem(RadixHeapItem * item);
+		void removeFromBucket(RadixHeapItem * item);
+		void redistribute();
+		void checkMonotone(N prio) const;
+
+	private:
+
+		class RadixHeapItem : public QueueEntry<N, E>
+		{
+		public:
+
+			int bucket;
+			size_t index;
+
+			RadixHeapItem(E pData, N pPrio);
+			~RadixHeapItem() = default;
+			void setPrio(N newPrio);
+			unsigned long long key() const;
+
+		};
+
+	};
+
+	//
+	// RadixHeapItem
+	//
+	template<typename N, typename E>
+	RadixHeap<N, E>::RadixHeapItem::RadixHeapItem(E pData, N pPrio) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		bucket(0),
+		index(0)
+	{
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::RadixHeapItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	template<typename N, typename E>
+	unsigned long long RadixHeap<N, E>::RadixHeapItem::key() const
+	{
+		return RadixKey<N>::toKey(this->getPrio());
+	}
+
+	//
+	// RadixHeap
+	//
+	template<typename N, typename E>
+	RadixHeap<N, E>::RadixHeap() :
+		lastKey(0),
+		dataSize(0)
+	{
+	}
+
+	template<typename N, typename E>
+	RadixHeap<N, E>::~RadixHeap()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E> * RadixHeap<N, E>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E> * RadixHeap<N, E>::insert(E && data, N prio)
+	{
+		this->checkMonotone(prio);
+
+		auto * item = new RadixHeapItem(std::move(data), prio);
+		this->placeItem(item);
+		++this->dataSize;
+
+		return item;
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(item, newPrio);
+		this->checkMonotone(newPrio);
+
+		item.setPrio(newPrio);
+
+		if (this->bucketIndex(item.key()) != item.bucket)
+		{
+			this->removeFromBucket(&item);
+			this->placeItem(&item);
+		}
+	}
+
+	template<typename N, typename E>
+	PriorityQueue<N, E> * RadixHeap<N, E>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherRadix = dynamic_cast<RadixHeap<N, E> *>(other);
+
+		if (!otherRadix)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		std::vector<RadixHeapItem*> items;
+		items.reserve(this->dataSize + otherRadix->dataSize);
+
+		for (int i = 0; i < BucketCount; i++)
+		{
+			items.insert(items.end(), this->buckets[i].begin(), this->buckets[i].end());
+			items.insert(items.end(), otherRadix->buckets[i].begin(), otherRadix->buckets[i].end());
+			this->buckets[i].clear();
+			otherRadix->buckets[i].clear();
+		}
+
+		// buckets are relative to the last minimum, with the lower one all items can be placed again
+		this->lastKey = std::min(this->lastKey, otherRadix->lastKey);
+		this->dataSize += otherRadix->dataSize;
+
+		otherRadix->dataSize = 0;
+		otherRadix->lastKey = 0;
+
+		for (RadixHeapItem * item : items)
+		{
+			this->placeItem(item);
+		}
+
+		return this;
+	}
+
+	template<typename N, typename E>
+	std::pair<E, N> RadixHeap<N, E>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		this->redistribute();
+
+		RadixHeapItem * poped = this->buckets[0].back();
+		this->buckets[0].pop_back();
+
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		if (--this->dataSize == 0)
+		{
+			this->lastKey = 0;
+		}
+
+		return popedData;
+	}
+
+	template<typename N, typename E>
+	E RadixHeap<N, E>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E>
+	E & RadixHeap<N, E>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		this->redistribute();
+
+		return this->buckets[0].back()->getData();
+	}
+
+	template<typename N, typename E>
+	size_t RadixHeap<N, E>::size()
+	{
+		return this->dataSize;
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::clear()
+	{
+		for (std::vector<RadixHeapItem*> & bucket : this->buckets)
+		{
+			for (RadixHeapItem * item : bucket)
+			{
+				delete item;
+			}
+
+			bucket.clear();
+		}
+
+		this->lastKey = 0;
+		this->dataSize = 0;
+	}
+
+	template<typename N, typename E>
+	int RadixHeap<N, E>::bucketIndex(const unsigned long long key) const
+	{
+		return key == this->lastKey ? 0 : BitOps::highestSetBit(key ^ this->lastKey) + 1;
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::placeItem(RadixHeapItem * item)
+	{
+		item->bucket = this->bucketIndex(item->key());
+		std::vector<RadixHeapItem*> & bucket = this->buckets[item->bucket];
+		item->index = bucket.size();
+		bucket.push_back(item);
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::removeFromBucket(RadixHeapItem * item)
+	{
+		std::vector<RadixHeapItem*> & bucket = this->buckets[item->bucket];
+		RadixHeapItem * last = bucket.back();
+		bucket[item->index] = last;
+		last->index = item->index;
+		bucket.pop_back();
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::redistribute()
+	{
+		if (!this->buckets[0].empty())
+		{
+			return;
+		}
+
+		int i = 1;
+		while (this->buckets[i].empty())
+		{
+			++i;
+		}
+
+		std::vector<RadixHeapItem*> & bucket = this->buckets[i];
+
+		RadixHeapItem * min = bucket[0];
+		for (RadixHeapItem * item : bucket)
+		{
+			if (*item < *min)
+			{
+				min = item;
+			}
+		}
+
+		// every item of bucket i now differs from the new minimum in a lower bit than i
+		this->lastKey = min->key();
+
+		std::vector<RadixHeapItem*> moved;
+		moved.swap(bucket);
+
+		for (RadixHeapItem * item : moved)
+		{
+			this->placeItem(item);
+		}
+
+		moved.clear();
+		moved.swap(bucket);
+	}
+
+	template<typename N, typename E>
+	void RadixHeap<N, E>::checkMonotone(N prio) const
+	{
+		if (RadixKey<N>::toKey(prio) < this->lastKey)
+		{
+			throw std::invalid_argument("Priority must not be lower than the last extracted minimum.");
+		}
+	}
+
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <iostream>
 
 #include "Graph.h"
+#include "CsrGraph.h"
 
 namespace uniza_fri {
 
@@ -28,8 +29,19 @@ namespace uniza_fri {
 		 */
 		template<typename vertex_data_t>
 		static Graph<ull, vertex_data_t> * load(const std::string & name);
+
+		/*
+			Natan graf vrti ako intanciu triedy CsrGraph,
+			hrany s u usporiadan do svislch pol.
+			Intancia je alokovan opertorom new,
+			take sa treba postara o jej zmazanie.
+		 */
+		static CsrGraph<ull> * loadCsr(const std::string & name);
 	
 	private:
+
+		template<typename graph_t>
+		static graph_t * loadGraph(const std::string & name);
 		
 		template<typename t1, typename t2, typename t3, typename t4>
 		static void split(std::string & line, std::tuple<t1, t2, t3, t4> & tpl);
@@ -49,6 +61,24 @@ namespace uniza_fri {
 
 	template<typename vertex_data_t>
 	Graph<ull, vertex_data_t>* Roads::load(const std::string & name)
+	{
+		return loadGraph<Graph<ull, vertex_data_t>>(name);
+	}
+
+	inline CsrGraph<ull>* Roads::loadCsr(const std::string & name)
+	{
+		auto * graph = loadGraph<CsrGraph<ull>>(name);
+
+		if (graph)
+		{
+			graph->build();
+		}
+
+		return graph;
+	}
+
+	template<typename graph_t>
+	graph_t * Roads::loadGraph(const std::string & name)
 	{
 		const std::string fileName("roads/" + name + ".gr");
 		std::ifstream ifs(fileName);
@@ -65,7 +95,7 @@ namespace uniza_fri {
 		const size_t vertexCount(std::get<2>(head));
 		const size_t edgeCount(std::get<3>(head));
 
-		auto * graph = new Graph<ull, vertex_data_t>(name, 0, std::numeric_limits<ull>::max() / 2, vertexCount + 1);
+		auto * graph = new graph_t(name, 0, std::numeric_limits<ull>::max() / 2, vertexCount + 1);
 
 		for (size_t i = 0; i < 2; i++) std::getline(ifs, line); // just skip lines
 
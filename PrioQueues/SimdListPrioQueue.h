@@ -0,0 +1,296 @@
+#pragma once
+
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include "PriorityQueue.h"
+#include "AlignedAllocator.h"
+#include "SimdOps.h"
+
+namespace uniza_fri {
+
+	/**
+		< Complexities >
+
+		insert		-> O(1)
+		findMin		-> O(n), O(1) if the minimum is cached
+		decreaseKey	-> O(1)
+		meld		-> O(n + m)
+		deleteMin	-> O(n)
+
+		< Template parameters >
+
+		Order -> ordering policy (MinOrder, MaxOrder).
+
+		Unsorted list like JustListPrioQueue, but stored as structure of arrays.
+		Priorities are in one contiguous array aligned to the cache line and items
+		in a parallel one, so searching for the minimum reads only the priorities
+		and with MinOrder it is a vectorized reduction (see SimdOps).
+		Position of the minimum is cached: insert and decreaseKey keep it up to date,
+		deleteMin invalidates it, so findMin followed by deleteMin scans only once.
+	*/
+	template<typename N, typename E, typename Order = MinOrder<N>>
+	class SimdListPrioQueue final : public PriorityQueue<N, E>
+	{
+	private:
+
+		class SimdListItem;
+
+		static const size_t UnknownMin = static_cast<size_t>(-1);
+
+	private:
+
+		std::vector<N, AlignedAllocator<N>> prios;
+		std::vector<SimdListItem*> items;
+		size_t minIndex;
+
+	public:
+
+		typedef SimdListItem entry_t;
+
+		SimdListPrioQueue();
+		virtual ~SimdListPrioQueue();
+
+		QueueEntry<N, E> * insert(const E & data, N prio)       override;
+		QueueEntry<N, E> * insert(E && data, N prio)            override;
+		void decreaseKey(QueueEntry<N, E> & entry, N newPrio)   override;
+		void decreaseKey(entry_t & entry, N newPrio);
+		PriorityQueue<N, E> * meld(PriorityQueue<N, E> * other) override;
+		E deleteMin()                                           override;
+		std::pair<E, N> popMin()                                override;
+		E & findMin()                                           override;
+		size_t size()                                           override;
+		void clear()                                            override;
+		void reserve(size_t n)                                  override;
+
+	private:
+
+		size_t getMinIndex();
+		size_t scanMinIndex(std::true_type vectorized) const;
+		size_t scanMinIndex(std::false_type vectorized) const;
+
+	private:
+
+		class SimdListItem : public QueueEntry<N, E>
+		{
+		public:
+
+			size_t index;
+
+			SimdListItem(E pData, N pPrio, size_t pIndex);
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	//
+	// SimdListItem
+	//
+	template<typename N, typename E, typename Order>
+	SimdListPrioQueue<N, E, Order>::SimdListItem::SimdListItem(E pData, N pPrio, size_t pIndex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		index(pIndex)
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	void SimdListPrioQueue<N, E, Order>::SimdListItem::setPrio(N newPrio)
+	{
+		QueueEntry<N, E>::setPrioInternal(newPrio);
+	}
+
+	//
+	// SimdListPrioQueue
+	//
+	template<typename N, typename E, typename Order>
+	SimdListPrioQueue<N, E, Order>::SimdListPrioQueue() :
+		minIndex(UnknownMin)
+	{
+	}
+
+	template<typename N, typename E, typename Order>
+	SimdListPrioQueue<N, E, Order>::~SimdListPrioQueue()
+	{
+		this->clear();
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E> * SimdListPrioQueue<N, E, Order>::insert(const E & data, N prio)
+	{
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E, typename Order>
+	QueueEntry<N, E> * SimdListPrioQueue<N, E, Order>::insert(E && data, N prio)
+	{
+		const size_t index = this->items.size();
+
+		auto * newItem = new SimdListItem(std::move(data), prio, index);
+		this->prios.push_back(prio);
+		this->items.push_back(newItem);
+
+		if (index == 0 || (this->minIndex != UnknownMin && Order::before(prio, this->prios[this->minIndex])))
+		{
+			this->minIndex = index;
+		}
+
+		return newItem;
+	}
+
+	template<typename N, typename E, typename Order>
+	void SimdListPrioQueue<N, E, Order>::decreaseKey(QueueEntry<N, E> & entry, N newPrio)
+	{
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E, typename Order>
+	void SimdListPrioQueue<N, E, Order>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::template decKeyLogicCheck<Order>(item, newPrio);
+
+		item.setPrio(newPrio);
+		this->prios[item.index] = newPrio;
+
+		if (this->minIndex != UnknownMin && Order::before(newPrio, this->prios[this->minIndex]))
+		{
+			this->minIndex = item.index;
+		}
+	}
+
+	template<typename N, typename E, typename Order>
+	PriorityQueue<N, E> * SimdListPrioQueue<N, E, Order>::meld(PriorityQueue<N, E> * other)
+	{
+		auto * otherList = dynamic_cast<SimdListPrioQueue<N, E, Order> *>(other);
+
+		if (!otherList)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		const size_t oldSize = this->items.size();
+		this->prios.insert(this->prios.end(), otherList->prios.begin(), otherList->prios.end());
+		this->items.insert(this->items.end(), otherList->items.begin(), otherList->items.end());
+		otherList->prios.clear();
+		otherList->items.clear();
+		otherList->minIndex = UnknownMin;
+
+		for (size_t i = oldSize; i < this->items.size(); i++)
+		{
+			this->items[i]->index = i;
+		}
+
+		this->minIndex = UnknownMin;
+
+		return this;
+	}
+
+	template<typename N, typename E, typename Order>
+	std::pair<E, N> SimdListPrioQueue<N, E, Order>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		const size_t popedIndex = this->getMinIndex();
+		SimdListItem * poped = this->items[popedIndex];
+		std::pair<E, N> popedData(std::move(poped->getData()), poped->getPrio());
+
+		// the last item takes the place of the poped one, unless it is the poped one
+		if (popedIndex + 1 < this->items.size())
+		{
+			this->prios[popedIndex] = this->prios.back();
+			this->items[popedIndex] = this->items.back();
+			this->items[popedIndex]->index = popedIndex;
+		}
+
+		this->prios.pop_back();
+		this->items.pop_back();
+		delete poped;
+
+		this->minIndex = UnknownMin;
+
+		return popedData;
+	}
+
+	template<typename N, typename E, typename Order>
+	E SimdListPrioQueue<N, E, Order>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
+	template<typename N, typename E, typename Order>
+	E & SimdListPrioQueue<N, E, Order>::findMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		return this->items[this->getMinIndex()]->getData();
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t SimdListPrioQueue<N, E, Order>::size()
+	{
+		return this->items.size();
+	}
+
+	template<typename N, typename E, typename Order>
+	void SimdListPrioQueue<N, E, Order>::clear()
+	{
+		for (SimdListItem * item : this->items)
+		{
+			delete item;
+		}
+
+		this->prios.clear();
+		this->items.clear();
+		this->minIndex = UnknownMin;
+	}
+
+	template<typename N, typename E, typename Order>
+	void SimdListPrioQueue<N, E, Order>::reserve(const size_t n)
+	{
+		this->prios.reserve(n);
+		this->items.reserve(n);
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t SimdListPrioQueue<N, E, Order>::getMinIndex()
+	{
+		if (this->minIndex == UnknownMin)
+		{
+			this->minIndex = this->scanMinIndex(std::is_same<Order, MinOrder<N>>());
+		}
+
+		return this->minIndex;
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t SimdListPrioQueue<N, E, Order>::scanMinIndex(std::true_type) const
+	{
+		return SimdOps::minIndex(this->prios.data(), this->prios.size());
+	}
+
+	template<typename N, typename E, typename Order>
+	size_t SimdListPrioQueue<N, E, Order>::scanMinIndex(std::false_type) const
+	{
+		const N * prio = this->prios.data();
+		const size_t count = this->prios.size();
+		size_t index = 0;
+
+		for (size_t i = 1; i < count; i++)
+		{
+			if (Order::before(prio[i], prio[index]))
+			{
+				index = i;
+			}
+		}
+
+		return index;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+
+namespace uniza_fri {
+
+	/**
+		Search for the first smallest key written once for all vector widths.
+		Lanes wraps the instructions for one key type and one instruction set:
+		load, lane-wise min, broadcast of a single key, mask of lanes equal to
+		another vector and store (see SimdOps and SimdOpsAvx2.cpp).
+		The header includes nothing else of the project on purpose. It is also
+		compiled with AVX2 enabled in SimdOpsAvx2.cpp and every function it uses
+		must be instantiated for the Lanes of that file only, otherwise the linker
+		could hand the AVX2 copy of a shared inline function to the rest of the program.
+	*/
+	template<typename Lanes>
+	class SimdMinScan
+	{
+	public:
+
+		typedef typename Lanes::value_t value_t;
+		typedef typename Lanes::vec_t vec_t;
+
+		/**
+			@return Index of the first smallest of count keys. count must not be 0.
+		*/
+		static size_t minIndex(const value_t * keys, size_t count);
+
+	private:
+
+		static size_t scalarMinIndex(const value_t * keys, size_t count);
+		static size_t indexOf(const value_t * keys, size_t count, value_t value);
+
+	};
+
+	template<typename Lanes>
+	size_t SimdMinScan<Lanes>::minIndex(const value_t * keys, const size_t count)
+	{
+		const size_t Width = Lanes::Width;
+
+		if (count < 4 * Width)
+		{
+			return SimdMinScan<Lanes>::scalarMinIndex(keys, count);
+		}
+
+		// four independent minimums, so that a min does not wait for the previous one
+		vec_t min0 = Lanes::load(keys);
+		vec_t min1 = Lanes::load(keys + Width);
+		vec_t min2 = Lanes::load(keys + 2 * Width);
+		vec_t min3 = Lanes::load(keys + 3 * Width);
+
+		size_t i = 4 * Width;
+		for (; i + 4 * Width <= count; i += 4 * Width)
+		{
+			min0 = Lanes::min(min0, Lanes::load(keys + i));
+			min1 = Lanes::min(min1, Lanes::load(keys + i + Width));
+			min2 = Lanes::min(min2, Lanes::load(keys + i + 2 * Width));
+			min3 = Lanes::min(min3, Lanes::load(keys + i + 3 * Width));
+		}
+
+		for (; i + Width <= count; i += Width)
+		{
+			min0 = Lanes::min(min0, Lanes::load(keys + i));
+		}
+
+		value_t lanes[Lanes::Width];
+		Lanes::store(lanes, Lanes::min(Lanes::min(min0, min1), Lanes::min(min2, min3)));
+
+		value_t minValue = lanes[0];
+		for (size_t lane = 1; lane < Width; lane++)
+		{
+			if (lanes[lane] < minValue)
+			{
+				minValue = lanes[lane];
+			}
+		}
+
+		for (; i < count; i++)
+		{
+			if (keys[i] < minValue)
+			{
+				minValue = keys[i];
+			}
+		}
+
+		// first position of the minimum, again a whole vector at a time
+		const vec_t wanted = Lanes::broadcast(minValue);
+		size_t j = 0;
+		for (; j + Width <= count; j += Width)
+		{
+			const int mask = Lanes::equalMask(Lanes::load(keys + j), wanted);
+
+			if (mask != 0)
+			{
+				size_t lane = 0;
+				while (!(mask & (1 << lane)))
+				{
+					lane++;
+				}
+
+				return j + lane;
+			}
+		}
+
+		return j + SimdMinScan<Lanes>::indexOf(keys + j, count - j, minValue);
+	}
+
+	template<typename Lanes>
+	size_t SimdMinScan<Lanes>::scalarMinIndex(const value_t * keys, const size_t count)
+	{
+		size_t index = 0;
+
+		for (size_t i = 1; i < count; i++)
+		{
+			if (keys[i] < keys[index])
+			{
+				index = i;
+			}
+		}
+
+		return index;
+	}
+
+	template<typename Lanes>
+	size_t SimdMinScan<Lanes>::indexOf(const value_t * keys, const size_t count, const value_t value)
+	{
+		size_t index = 0;
+
+		while (index + 1 < count && keys[index] != value)
+		{
+			index++;
+		}
+
+		return index;
+	}
+
+}
@@ -0,0 +1,34 @@
+#include "SimdOps.h"
+
+#if defined(_MSC_VER) && defined(SIMD_OPS_AVX2_DISPATCH)
+#include <intrin.h>
+#endif
+
+namespace uniza_fri {
+
+	const bool SimdOps::Avx2Supported = SimdOps::detectAvx2();
+
+	bool SimdOps::detectAvx2()
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH) && defined(_MSC_VER)
+		int info[4];
+
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+
+		// AVX and OSXSAVE, then the operating system must save the ymm registers
+		__cpuid(info, 1);
+		if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+		if ((_xgetbv(0) & 6) != 6) return false;
+
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#elif defined(SIMD_OPS_AVX2_DISPATCH)
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#else
+		return false;
+#endif
+	}
+
+}
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "SimdMinScan.h"
+#include "SimdOpsAvx2.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define SIMD_OPS_AVX2_DISPATCH
+#endif
+
+#if defined(__SSE4_2__) || defined(__AVX__)
+#define SIMD_OPS_SSE4
+#include <nmmintrin.h>
+#endif
+
+namespace uniza_fri {
+
+	/**
+		Vectorized scans of contiguous key arrays used by the flat queues.
+		On x86 the AVX2 variants in SimdOpsAvx2 are used whenever the CPU supports them.
+		That is checked once at startup and only SimdOpsAvx2.cpp is compiled with AVX2,
+		so the program still runs on older CPUs. Otherwise the scan uses SSE4.2 if the
+		build enables it (/arch:AVX, -msse4.2), or plain scalar code. Overloads exist
+		for 32 and 64 bit integers and double; other key types use the scalar template.
+	*/
+	class SimdOps
+	{
+	public:
+
+		/**
+			@return Index of the first smallest of count keys. count must not be 0.
+		*/
+		template<typename N>
+		static size_t minIndex(const N * keys, size_t count);
+
+		static size_t minIndex(const int32_t * keys, size_t count);
+		static size_t minIndex(const uint32_t * keys, size_t count);
+		static size_t minIndex(const long long * keys, size_t count);
+		static size_t minIndex(const unsigned long long * keys, size_t count);
+		static size_t minIndex(const double * keys, size_t count);
+
+	private:
+
+		static const bool Avx2Supported;
+
+		static bool hasAvx2();
+		static bool detectAvx2();
+
+		template<typename Lanes>
+		static size_t minIndexFallback(const typename Lanes::value_t * keys, size_t count);
+
+		/**
+			Each Lanes struct wraps the instructions for one key type: load, lane-wise min,
+			broadcast of a single key, mask of lanes equal to another vector and store.
+			Unsigned 64 bit keys are loaded with flipped sign bits, because there is
+			only a signed 64 bit compare, and flipped back on store.
+			Without SSE4.2 they only name the key type for the scalar fallback.
+		*/
+#if defined(SIMD_OPS_SSE4)
+
+		struct Int32Lanes
+		{
+			typedef int32_t value_t;
+			typedef __m128i vec_t;
+			static const size_t Width = 4;
+			static vec_t load(const value_t * p) { return _mm_loadu_si128(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm_min_epi32(a, b); }
+			static vec_t broadcast(value_t value) { return _mm_set1_epi32(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm_storeu_si128(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct UInt32Lanes
+		{
+			typedef uint32_t value_t;
+			typedef __m128i vec_t;
+			static const size_t Width = 4;
+			static vec_t load(const value_t * p) { return _mm_loadu_si128(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm_min_epu32(a, b); }
+			static vec_t broadcast(value_t value) { return _mm_set1_epi32(static_cast<int>(value)); }
+			static int equalMask(vec_t a, vec_t b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm_storeu_si128(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct Int64Lanes
+		{
+			typedef long long value_t;
+			typedef __m128i vec_t;
+			static const size_t Width = 2;
+			static vec_t load(const value_t * p) { return _mm_loadu_si128(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+			static vec_t broadcast(value_t value) { return _mm_set1_epi64x(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm_storeu_si128(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct UInt64Lanes
+		{
+			typedef unsigned long long value_t;
+			typedef __m128i vec_t;
+			static const size_t Width = 2;
+			static vec_t sign() { return _mm_set1_epi64x(INT64_MIN); }
+			static vec_t load(const value_t * p) { return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const vec_t*>(p)), sign()); }
+			static vec_t min(vec_t a, vec_t b) { return _mm_blendv_epi8(a, b, _mm_cmpgt_epi64(a, b)); }
+			static vec_t broadcast(value_t value) { return _mm_xor_si128(_mm_set1_epi64x(static_cast<long long>(value)), sign()); }
+			static int equalMask(vec_t a, vec_t b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm_storeu_si128(reinterpret_cast<vec_t*>(p), _mm_xor_si128(v, sign())); }
+		};
+
+		struct DoubleLanes
+		{
+			typedef double value_t;
+			typedef __m128d vec_t;
+			static const size_t Width = 2;
+			static vec_t load(const value_t * p) { return _mm_loadu_pd(p); }
+			static vec_t min(vec_t a, vec_t b) { return _mm_min_pd(a, b); }
+			static vec_t broadcast(value_t value) { return _mm_set1_pd(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+			static void store(value_t * p, vec_t v) { _mm_storeu_pd(p, v); }
+		};
+
+#else
+
+		struct Int32Lanes { typedef int32_t value_t; };
+		struct UInt32Lanes { typedef uint32_t value_t; };
+		struct Int64Lanes { typedef long long value_t; };
+		struct UInt64Lanes { typedef unsigned long long value_t; };
+		struct DoubleLanes { typedef double value_t; };
+
+#endif
+
+	};
+
+	template<typename N>
+	size_t SimdOps::minIndex(const N * keys, const size_t count)
+	{
+		size_t index = 0;
+
+		for (size_t i = 1; i < count; i++)
+		{
+			if (keys[i] < keys[index])
+			{
+				index = i;
+			}
+		}
+
+		return index;
+	}
+
+	inline size_t SimdOps::minIndex(const int32_t * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH)
+		if (SimdOps::hasAvx2())
+		{
+			return SimdOpsAvx2::minIndex(keys, count);
+		}
+#endif
+		return SimdOps::minIndexFallback<Int32Lanes>(keys, count);
+	}
+
+	inline size_t SimdOps::minIndex(const uint32_t * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH)
+		if (SimdOps::hasAvx2())
+		{
+			return SimdOpsAvx2::minIndex(keys, count);
+		}
+#endif
+		return SimdOps::minIndexFallback<UInt32Lanes>(keys, count);
+	}
+
+	inline size_t SimdOps::minIndex(const long long * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH)
+		if (SimdOps::hasAvx2())
+		{
+			return SimdOpsAvx2::minIndex(keys, count);
+		}
+#endif
+		return SimdOps::minIndexFallback<Int64Lanes>(keys, count);
+	}
+
+	inline size_t SimdOps::minIndex(const unsigned long long * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH)
+		if (SimdOps::hasAvx2())
+		{
+			return SimdOpsAvx2::minIndex(keys, count);
+		}
+#endif
+		return SimdOps::minIndexFallback<UInt64Lanes>(keys, count);
+	}
+
+	inline size_t SimdOps::minIndex(const double * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_AVX2_DISPATCH)
+		if (SimdOps::hasAvx2())
+		{
+			return SimdOpsAvx2::minIndex(keys, count);
+		}
+#endif
+		return SimdOps::minIndexFallback<DoubleLanes>(keys, count);
+	}
+
+	inline bool SimdOps::hasAvx2()
+	{
+#if defined(__AVX2__)
+		return true;
+#else
+		return SimdOps::Avx2Supported;
+#endif
+	}
+
+	template<typename Lanes>
+	size_t SimdOps::minIndexFallback(const typename Lanes::value_t * keys, const size_t count)
+	{
+#if defined(SIMD_OPS_SSE4)
+		return SimdMinScan<Lanes>::minIndex(keys, count);
+#else
+		return SimdOps::minIndex<typename Lanes::value_t>(keys, count);
+#endif
+	}
+
+}
\ No newline at end of file
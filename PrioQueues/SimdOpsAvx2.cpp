@@ -0,0 +1,123 @@
+#include "SimdOpsAvx2.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+
+// Visual Studio compiles this file with /arch:AVX2 (see PrioQueues.vcxproj),
+// other compilers enable AVX2 for the functions below
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#include <immintrin.h>
+
+#include "SimdMinScan.h"
+
+namespace uniza_fri {
+
+	namespace {
+
+		/**
+			Unsigned 64 bit keys are loaded with flipped sign bits, because there is
+			only a signed 64 bit compare, and flipped back on store.
+		*/
+
+		struct Int32Lanes
+		{
+			typedef int32_t value_t;
+			typedef __m256i vec_t;
+			static const size_t Width = 8;
+			static vec_t load(const value_t * p) { return _mm256_loadu_si256(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm256_min_epi32(a, b); }
+			static vec_t broadcast(value_t value) { return _mm256_set1_epi32(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm256_storeu_si256(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct UInt32Lanes
+		{
+			typedef uint32_t value_t;
+			typedef __m256i vec_t;
+			static const size_t Width = 8;
+			static vec_t load(const value_t * p) { return _mm256_loadu_si256(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm256_min_epu32(a, b); }
+			static vec_t broadcast(value_t value) { return _mm256_set1_epi32(static_cast<int>(value)); }
+			static int equalMask(vec_t a, vec_t b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm256_storeu_si256(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct Int64Lanes
+		{
+			typedef long long value_t;
+			typedef __m256i vec_t;
+			static const size_t Width = 4;
+			static vec_t load(const value_t * p) { return _mm256_loadu_si256(reinterpret_cast<const vec_t*>(p)); }
+			static vec_t min(vec_t a, vec_t b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+			static vec_t broadcast(value_t value) { return _mm256_set1_epi64x(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm256_storeu_si256(reinterpret_cast<vec_t*>(p), v); }
+		};
+
+		struct UInt64Lanes
+		{
+			typedef unsigned long long value_t;
+			typedef __m256i vec_t;
+			static const size_t Width = 4;
+			static vec_t sign() { return _mm256_set1_epi64x(INT64_MIN); }
+			static vec_t load(const value_t * p) { return _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const vec_t*>(p)), sign()); }
+			static vec_t min(vec_t a, vec_t b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+			static vec_t broadcast(value_t value) { return _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(value)), sign()); }
+			static int equalMask(vec_t a, vec_t b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+			static void store(value_t * p, vec_t v) { _mm256_storeu_si256(reinterpret_cast<vec_t*>(p), _mm256_xor_si256(v, sign())); }
+		};
+
+		struct DoubleLanes
+		{
+			typedef double value_t;
+			typedef __m256d vec_t;
+			static const size_t Width = 4;
+			static vec_t load(const value_t * p) { return _mm256_loadu_pd(p); }
+			static vec_t min(vec_t a, vec_t b) { return _mm256_min_pd(a, b); }
+			static vec_t broadcast(value_t value) { return _mm256_set1_pd(value); }
+			static int equalMask(vec_t a, vec_t b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+			static void store(value_t * p, vec_t v) { _mm256_storeu_pd(p, v); }
+		};
+
+	}
+
+	size_t SimdOpsAvx2::minIndex(const int32_t * keys, const size_t count)
+	{
+		return SimdMinScan<Int32Lanes>::minIndex(keys, count);
+	}
+
+	size_t SimdOpsAvx2::minIndex(const uint32_t * keys, const size_t count)
+	{
+		return SimdMinScan<UInt32Lanes>::minIndex(keys, count);
+	}
+
+	size_t SimdOpsAvx2::minIndex(const long long * keys, const size_t count)
+	{
+		return SimdMinScan<Int64Lanes>::minIndex(keys, count);
+	}
+
+	size_t SimdOpsAvx2::minIndex(const unsigned long long * keys, const size_t count)
+	{
+		return SimdMinScan<UInt64Lanes>::minIndex(keys, count);
+	}
+
+	size_t SimdOpsAvx2::minIndex(const double * keys, const size_t count)
+	{
+		return SimdMinScan<DoubleLanes>::minIndex(keys, count);
+	}
+
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif
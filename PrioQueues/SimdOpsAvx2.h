@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace uniza_fri {
+
+	/**
+		AVX2 variants of SimdOps::minIndex. SimdOpsAvx2.cpp is the only file compiled
+		with AVX2 enabled, so the rest of the program runs on any x86 CPU and SimdOps
+		calls these only after it has checked that the CPU supports AVX2.
+	*/
+	class SimdOpsAvx2
+	{
+	public:
+
+		/**
+			@return Index of the first smallest of count keys. count must not be 0.
+		*/
+		static size_t minIndex(const int32_t * keys, size_t count);
+		static size_t minIndex(const uint32_t * keys, size_t count);
+		static size_t minIndex(const long long * keys, size_t count);
+		static size_t minIndex(const unsigned long long * keys, size_t count);
+		static size_t minIndex(const double * keys, size_t count);
+
+	};
+
+}
@@ -1,37 +1,135 @@
 #pragma once
 
-#include <queue>
 #include <vector>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <utility>
 #include "PriorityQueue.h"
+#include "BitOps.h"
+#include "vid_t.h"
 
 namespace uniza_fri {
 
+	/**
+		< Complexities >
+
+		insert		-> O(log n)
+		findMin		-> O(1)
+		decreaseKey	-> O(log n)
+		meld		-> O(n + m)
+		deleteMin	-> O(log n)
+
+		Binary heap laid out the way std::make_heap and std::priority_queue keep it,
+		but over inline (priority, item) pairs instead of QueueEntry pointers, so sifting
+		compares without dereferencing items. Each item remembers its position in the array,
+		which is what decreaseKey uses. The std heap algorithms do not report where they move
+		elements, so only whole-array operations (meld, insertMany) use std::make_heap
+		and renumber the items afterwards; sifting of a single item is done here.
+	*/
 	template<typename N, typename E>
-	class StlBinaryHeap : public PriorityQueue<N, E>
+	class StlBinaryHeap final : public PriorityQueue<N, E>
 	{
 	private:
 
+		class StlHeapItem;
+
+		struct StlHeapSlot
+		{
+			N prio;
+			StlHeapItem * item;
+		};
+
 		struct Comparator
 		{
-			bool operator()(const QueueEntry<N, E> * e1, const QueueEntry<N, E> * e2) const;
+			bool operator()(const StlHeapSlot & s1, const StlHeapSlot & s2) const;
 		};
 
 	private:
 
-		std::priority_queue<QueueEntry<N, E>*, std::vector<QueueEntry<N, E>*>, Comparator> prioQueue;
+		std::vector<StlHeapSlot> slots;
 
 	public:
 
+		typedef StlHeapItem entry_t;
+
 		StlBinaryHeap();
 		virtual ~StlBinaryHeap();
 
 		QueueEntry<N, E>* insert(const E & data, N prio)      override;
+		QueueEntry<N, E>* insert(E && data, N prio)           override;
+		template<typename InputIt, typename OutputIt>
+		OutputIt insertMany(InputIt first, InputIt last, OutputIt out);
 		void decreaseKey(QueueEntry<N, E>& entry, N newPrio)  override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E>* meld(PriorityQueue<N, E>* other) override;
 		E deleteMin()                                         override;
+		std::pair<E, N> popMin()                              override;
 		E & findMin()                                         override;
 		size_t size()                                         override;
 		void clear()                                          override;
+		void reserve(size_t n)                                override;
+
+	private:
+
+		void place(size_t index, const StlHeapSlot & slot);
+		void siftUp(size_t index);
+		void siftDown(size_t index);
+		void makeHeap();
+
+	private:
+
+		class StlHeapItem : public QueueEntry<N, E>
+		{
+		public:
+
+			size_t index;
+
+			StlHeapItem(E pData, N pPrio, size_t pIndex);
+			void setPrio(N newPrio);
+
+		};
+
+	};
+
+	/**
+		< Complexities >
+
+		insert		-> O(log n)
+		findMin		-> O(1)
+		deleteMin	-> O(log n)
+
+		Flat binary heap of (priority, vertex) pairs, the same array std::priority_queue keeps,
+		but without entries and without decreaseKey. It is meant for lazy deletion: instead of
+		decreasing a key the vertex is inserted again and the older copy is skipped when it
+		gets popped. Unlike std::priority_queue it can be cleared without freeing its array,
+		so it can be reused between searches.
+	*/
+	template<typename N>
+	class StlLazyBinaryHeap final
+	{
+	private:
+
+		typedef std::pair<N, vid_t> slot_t;
+
+	private:
+
+		std::vector<slot_t> slots;
+
+	public:
+
+		void insert(vid_t id, N prio);
+
+		/**
+			Throws std::out_of_range if heap is empty.
+			@return Vertex with highest priority and its priority.
+		*/
+		std::pair<vid_t, N> popMin();
+
+		size_t size() const;
+		bool isEmpty() const;
+		void clear();
+		void reserve(size_t n);
 
 	};
 
@@ -39,9 +137,25 @@ namespace uniza_fri {
 	// Comparator
 	//
 	template<typename N, typename E>
-	bool StlBinaryHeap<N, E>::Comparator::operator()(const QueueEntry<N, E> * e1, const QueueEntry<N, E> * e2) const
+	bool StlBinaryHeap<N, E>::Comparator::operator()(const StlHeapSlot & s1, const StlHeapSlot & s2) const
+	{
+		return s2.prio < s1.prio;
+	}
+
+	//
+	// StlHeapItem
+	//
+	template<typename N, typename E>
+	StlBinaryHeap<N, E>::StlHeapItem::StlHeapItem(E pData, N pPrio, size_t pIndex) :
+		QueueEntry<N, E>(std::move(pData), pPrio),
+		index(pIndex)
+	{
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::StlHeapItem::setPrio(N newPrio)
 	{
-		return !(e1->getPrio() < e2->getPrio());
+		QueueEntry<N, E>::setPrioInternal(newPrio);
 	}
 
 	//
@@ -55,43 +169,122 @@ namespace uniza_fri {
 	template<typename N, typename E>
 	StlBinaryHeap<N, E>::~StlBinaryHeap()
 	{
+		this->clear();
 	}
 
 	template<typename N, typename E>
 	QueueEntry<N, E>* StlBinaryHeap<N, E>::insert(const E & data, N prio)
 	{
-		QueueEntry<N, E> * entry = new QueueEntry<N, E>(data, prio);
-		this->prioQueue.push(entry);
-		return entry;
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E>* StlBinaryHeap<N, E>::insert(E && data, N prio)
+	{
+		const size_t index = this->slots.size();
+
+		StlHeapItem * newItem = new StlHeapItem(std::move(data), prio, index);
+		this->slots.push_back(StlHeapSlot{ prio, newItem });
+		this->siftUp(index);
+
+		return newItem;
+	}
+
+	template<typename N, typename E>
+	template<typename InputIt, typename OutputIt>
+	OutputIt StlBinaryHeap<N, E>::insertMany(InputIt first, InputIt last, OutputIt out)
+	{
+		const size_t oldSize = this->slots.size();
+
+		for (; first != last; ++first)
+		{
+			StlHeapItem * newItem = new StlHeapItem(first->first, first->second, this->slots.size());
+			this->slots.push_back(StlHeapSlot{ first->second, newItem });
+			*out++ = newItem;
+		}
+
+		const size_t newCount = this->slots.size() - oldSize;
+
+		// same rule as in BinaryHeap: sifting up costs up to log n per new item, make_heap n for the whole array
+		if (newCount != 0 && newCount * BitOps::highestSetBit(this->slots.size()) >= this->slots.size())
+		{
+			this->makeHeap();
+		}
+		else
+		{
+			for (size_t i = oldSize; i < this->slots.size(); i++)
+			{
+				this->siftUp(i);
+			}
+		}
+
+		return out;
 	}
 
 	template<typename N, typename E>
 	void StlBinaryHeap<N, E>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
 	{
-		throw new std::exception("Unsupported operation.");
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::decreaseKey(entry_t & item, N newPrio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(item, newPrio);
+
+		item.setPrio(newPrio);
+		this->slots[item.index].prio = newPrio;
+		this->siftUp(item.index);
 	}
 
 	template<typename N, typename E>
 	PriorityQueue<N, E>* StlBinaryHeap<N, E>::meld(PriorityQueue<N, E>* other)
 	{
-		throw new std::exception("Unsupported operation.");
+		auto * otherStl = dynamic_cast<StlBinaryHeap<N, E> *>(other);
+
+		if (!otherStl)
+		{
+			throw std::logic_error("Queues must be of same type.");
+		}
+
+		this->slots.insert(this->slots.end(), otherStl->slots.begin(), otherStl->slots.end());
+		otherStl->slots.clear();
+
+		this->makeHeap();
+
+		return this;
 	}
 
 	template<typename N, typename E>
-	E StlBinaryHeap<N, E>::deleteMin()
+	std::pair<E, N> StlBinaryHeap<N, E>::popMin()
 	{
 		if (this->isEmpty())
 		{
 			throw std::out_of_range("Priority queue is empty.");
 		}
 
-		QueueEntry<N, E> * entry = this->prioQueue.top();
-		E ret = entry->getData();
-		this->prioQueue.pop();
-		delete entry;
+		StlHeapItem * poped = this->slots.front().item;
+		const StlHeapSlot last = this->slots.back();
+		this->slots.pop_back();
+
+		std::pair<E, N> ret(std::move(poped->getData()), poped->getPrio());
+		delete poped;
+
+		if (!this->slots.empty())
+		{
+			this->place(0, last);
+			this->siftDown(0);
+		}
+
 		return ret;
 	}
 
+	template<typename N, typename E>
+	E StlBinaryHeap<N, E>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
 	template<typename N, typename E>
 	E & StlBinaryHeap<N, E>::findMin()
 	{
@@ -101,24 +294,144 @@ namespace uniza_fri {
 		}
 		else
 		{
-			return this->prioQueue.top()->getData();
+			return this->slots.front().item->getData();
 		}
 	}
 
 	template<typename N, typename E>
 	size_t StlBinaryHeap<N, E>::size()
 	{
-		return this->prioQueue.size();
+		return this->slots.size();
 	}
 
 	template<typename N, typename E>
 	void StlBinaryHeap<N, E>::clear()
 	{
-		while (!this->prioQueue.empty())
+		for (const StlHeapSlot & slot : this->slots)
+		{
+			delete slot.item;
+		}
+
+		this->slots.clear();
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::reserve(const size_t n)
+	{
+		this->slots.reserve(n);
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::place(const size_t index, const StlHeapSlot & slot)
+	{
+		this->slots[index] = slot;
+		slot.item->index = index;
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::siftUp(size_t index)
+	{
+		const StlHeapSlot moved = this->slots[index];
+		const Comparator comp;
+
+		while (index > 0)
 		{
-			delete this->prioQueue.top();
-			this->prioQueue.pop();
+			const size_t parentIndex = (index - 1) >> 1;
+
+			if (!comp(this->slots[parentIndex], moved)) break;
+
+			this->place(index, this->slots[parentIndex]);
+			index = parentIndex;
 		}
+
+		this->place(index, moved);
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::siftDown(size_t index)
+	{
+		const StlHeapSlot moved = this->slots[index];
+		const size_t count = this->slots.size();
+		const Comparator comp;
+
+		for (;;)
+		{
+			size_t childIndex = (index << 1) + 1;
+
+			if (childIndex >= count) break;
+
+			if (childIndex + 1 < count && comp(this->slots[childIndex], this->slots[childIndex + 1]))
+			{
+				++childIndex;
+			}
+
+			if (!comp(moved, this->slots[childIndex])) break;
+
+			this->place(index, this->slots[childIndex]);
+			index = childIndex;
+		}
+
+		this->place(index, moved);
+	}
+
+	template<typename N, typename E>
+	void StlBinaryHeap<N, E>::makeHeap()
+	{
+		std::make_heap(this->slots.begin(), this->slots.end(), Comparator());
+
+		for (size_t i = 0; i < this->slots.size(); i++)
+		{
+			this->slots[i].item->index = i;
+		}
+	}
+
+	//
+	// StlLazyBinaryHeap
+	//
+	template<typename N>
+	void StlLazyBinaryHeap<N>::insert(const vid_t id, N prio)
+	{
+		this->slots.emplace_back(prio, id);
+		std::push_heap(this->slots.begin(), this->slots.end(), std::greater<slot_t>());
+	}
+
+	template<typename N>
+	std::pair<vid_t, N> StlLazyBinaryHeap<N>::popMin()
+	{
+		if (this->isEmpty())
+		{
+			throw std::out_of_range("Priority queue is empty.");
+		}
+
+		std::pop_heap(this->slots.begin(), this->slots.end(), std::greater<slot_t>());
+		const slot_t poped = this->slots.back();
+		this->slots.pop_back();
+
+		return std::pair<vid_t, N>(poped.second, poped.first);
+	}
+
+	template<typename N>
+	size_t StlLazyBinaryHeap<N>::size() const
+	{
+		return this->slots.size();
+	}
+
+	template<typename N>
+	bool StlLazyBinaryHeap<N>::isEmpty() const
+	{
+		return this->slots.empty();
+	}
+
+	template<typename N>
+	void StlLazyBinaryHeap<N>::clear()
+	{
+		this->slots.clear();
+	}
+
+	template<typename N>
+	void StlLazyBinaryHeap<N>::reserve(const size_t n)
+	{
+		this->slots.reserve(n);
 	}
 
 }
\ No newline at end of file
@@ -38,6 +38,8 @@ namespace uniza_fri {
 
 	public:
 
+		typedef StrictFibEntry entry_t;
+
 		// These two would be complicated to implement
 		StrictFibonacciHeap(const StrictFibonacciHeap & other) = delete;
 		StrictFibonacciHeap & operator=(const StrictFibonacciHeap & other) = delete;
@@ -50,9 +52,12 @@ namespace uniza_fri {
 
 		/// Implementation of the PriorityQueue interface
 		QueueEntry<N, E>* insert(const E & data, N prio)      override;
+		QueueEntry<N, E>* insert(E && data, N prio)           override;
 		void decreaseKey(QueueEntry<N, E>& entry, N newPrio)  override;
+		void decreaseKey(entry_t & entry, N newPrio);
 		PriorityQueue<N, E>* meld(PriorityQueue<N, E>* other) override;
 		E deleteMin()                                         override;
+		std::pair<E, N> popMin()                              override;
 		E & findMin()                                         override;
 		size_t size()                                         override;
 		void clear()                                          override;
@@ -142,7 +147,7 @@ namespace uniza_fri {
 			StrictFibNode & operator=(StrictFibNode & other)  = delete;
 			StrictFibNode & operator=(StrictFibNode && other) = delete;
 
-			StrictFibNode(const E & data, N prio);
+			StrictFibNode(E data, N prio);
 			~StrictFibNode();
 			void swapEntries(StrictFibNode * other);
 			void addActiveChild(StrictFibNode * newChild);
@@ -187,8 +192,8 @@ namespace uniza_fri {
 			StrictFibEntry & operator=(StrictFibEntry & other)  = delete;
 			StrictFibEntry & operator=(StrictFibEntry && other) = delete;
 
-			StrictFibEntry(const E & data, N prio, StrictFibNode * pNode);
-			virtual ~StrictFibEntry() = default;
+			StrictFibEntry(E data, N prio, StrictFibNode * pNode);
+			~StrictFibEntry() = default;
 
 			void setPrio(N newPrio);
 
@@ -363,7 +368,13 @@ namespace uniza_fri {
 	template<typename N, typename E>
 	QueueEntry<N, E>* StrictFibonacciHeap<N, E>::insert(const E & data, N prio)
 	{
-		auto * node(new StrictFibNode(data, prio));
+		return this->insert(E(data), prio);
+	}
+
+	template<typename N, typename E>
+	QueueEntry<N, E>* StrictFibonacciHeap<N, E>::insert(E && data, N prio)
+	{
+		auto * node(new StrictFibNode(std::move(data), prio));
 		QueueEntry<N, E> * retEntry(node->entry);
 
 		if (this->isEmpty())
@@ -401,9 +412,14 @@ namespace uniza_fri {
 	template<typename N, typename E>
 	void StrictFibonacciHeap<N, E>::decreaseKey(QueueEntry<N, E>& entry, N newPrio)
 	{
-		PriorityQueue<N, E>::decKeyLogicCheck(entry, newPrio);
+		this->decreaseKey(static_cast<entry_t&>(entry), newPrio);
+	}
+
+	template<typename N, typename E>
+	void StrictFibonacciHeap<N, E>::decreaseKey(entry_t & entrySf, N newPrio)
+	{
+		PriorityQueue<N, E>::decKeyLogicCheck(entrySf, newPrio);
 
-		auto& entrySf = dynamic_cast<StrictFibEntry&>(entry);
 		entrySf.setPrio(newPrio);
 		StrictFibNode * x = entrySf.node;
 
@@ -452,14 +468,14 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename E>
-	E StrictFibonacciHeap<N, E>::deleteMin()
+	std::pair<E, N> StrictFibonacciHeap<N, E>::popMin()
 	{
 		if (this->isEmpty())
 		{
 			throw std::out_of_range("Priority queue is empty.");
 		}
 
-		E retData(this->root->entry->getData());
+		std::pair<E, N> retData(std::move(this->root->entry->getData()), this->root->entry->getPrio());
 		StrictFibNode * oldRoot(this->root);
 
 		if (this->dataSize > 1)
@@ -506,6 +522,12 @@ namespace uniza_fri {
 		return retData;
 	}
 
+	template<typename N, typename E>
+	E StrictFibonacciHeap<N, E>::deleteMin()
+	{
+		return this->popMin().first;
+	}
+
 	template<typename N, typename E>
 	E & StrictFibonacciHeap<N, E>::findMin()
 	{
@@ -1414,8 +1436,8 @@ namespace uniza_fri {
 	}
 
 	template<typename N, typename E>
-	StrictFibonacciHeap<N, E>::StrictFibNode::StrictFibNode(const E & data, N prio) :
-		entry(new StrictFibEntry(data, prio, this)),
+	StrictFibonacciHeap<N, E>::StrictFibNode::StrictFibNode(E data, N prio) :
+		entry(new StrictFibEntry(std::move(data), prio, this)),
 		parent(nullptr),
 		left(this),
 		right(this),
@@ -1647,8 +1669,8 @@ namespace uniza_fri {
 	// StrictFibEntry
 	//
 	template<typename N, typename E>
-	StrictFibonacciHeap<N, E>::StrictFibEntry::StrictFibEntry(const E & data, N prio, StrictFibNode * pNode) :
-		QueueEntry<N, E>(data, prio),
+	StrictFibonacciHeap<N, E>::StrictFibEntry::StrictFibEntry(E data, N prio, StrictFibNode * pNode) :
+		QueueEntry<N, E>(std::move(data), prio),
 		node(pNode)
 	{
 	}
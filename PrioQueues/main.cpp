@@ -11,6 +11,8 @@
 
 using namespace uniza_fri;
 
+typedef CsrGraph<ull> road_graph_t;
+
 struct Integer
 {
 	int val;
@@ -22,9 +24,11 @@ struct Integer
 	Vlo do frontu TestCaseCount nhodnch sel, nsledne ich vyberie a kontroluje i s usporiadan.
 	Nsledne znovu vlo TestCaseCount nhodnch sel. Potom pri kadom vykon decreaseKey.
 	Nsledne znovu vetky vyberie a skontroluje usporiadanie.
+	Nakoniec opakovane napln dva fronty, spoj ich operciou meld a skontroluje vekos a usporiadanie vsledku.
+	Test opercie meld sa d vypn parametrom TestMeld.
 	Takto postup nemus nutne odali vetky chyby, ale pri vekom TestCaseCount prever vea rznych prpadov.
  */
-template<typename prio_queue_t, size_t TestCaseCount = 1000000, long Seed = 144>
+template<typename prio_queue_t, size_t TestCaseCount = 1000000, long Seed = 144, bool TestMeld = true>
 bool testCorrectness(const std::string & prioQueueName)
 {
 	try {
@@ -100,6 +104,66 @@ bool testCorrectness(const std::string & prioQueueName)
 		}
 
 		std::cout << " decrease -> pop after successful" << std::endl;
+
+		// Meld test
+		if (TestMeld)
+		{
+			const std::uniform_int_distribution<int> uniMeldCount(0, 64);
+
+			for (size_t round = 0; round < TestCaseCount / 100; round++)
+			{
+				std::unique_ptr<PriorityQueue<int, Integer>> other(Factory<prio_queue_t>::template makeQueue<int, Integer>());
+				const int thisCount = uniMeldCount(rng);
+				const int otherCount = uniMeldCount(rng);
+
+				for (int i = 0; i < thisCount; i++)
+				{
+					const int d = uniPush(rng);
+					Integer ig(d);
+					queue->insert(ig, d);
+				}
+
+				for (int i = 0; i < otherCount; i++)
+				{
+					const int d = uniPush(rng);
+					Integer ig(d);
+					other->insert(ig, d);
+				}
+
+				// niektor fronty vrtia z meld nov front a oba pvodn nechaj przdne
+				PriorityQueue<int, Integer> * melded = queue->meld(other.get());
+				if (melded == other.get())
+				{
+					queue.swap(other);
+				}
+				else if (melded != queue.get())
+				{
+					queue.reset(melded);
+				}
+
+				if (queue->size() != static_cast<size_t>(thisCount + otherCount))
+				{
+					std::cout << "# nespravna velkost po meld" << std::endl;
+					return false;
+				}
+
+				prevpoped = std::numeric_limits<int>::min();
+				while (!queue->isEmpty())
+				{
+					pp = queue->deleteMin();
+					const int poped = pp.val;
+					if (poped < prevpoped)
+					{
+						std::cout << "# nespravne usporiadanie po meld" << std::endl;
+						return false;
+					}
+					prevpoped = poped;
+				}
+			}
+
+			std::cout << " meld -> successful" << std::endl;
+		}
+
 		std::cout << " ---> test successful <---" << std::endl << std::endl;
 	
 		return true;
@@ -140,22 +204,29 @@ void labelSetExperiment(const std::string & pqname)
 
 	for (std::string & graphname : graphNames)
 	{
-		Graph<ull, DijkstraData<ull>> * graph = Roads::load<DijkstraData<ull>>(graphname);
-		Dijkstra<ull> pathfinder(graph);
+		road_graph_t * graph = Roads::loadCsr(graphname);
 		ValueStabilizer<100> stabilizer;
 		size_t replicationCount(0);
+		AllocationCounter::reset();
 
-		while (!stabilizer.isStable())
+		// fronty ij v pathfinder a aloktory ohlsia svoje uzly a pri zniku, preto vlastn blok
 		{
-			vid_t randomSrc(randomGenerator.nextUniqueSizeT(1, graph->getVertexCount()));
-			PathInfo<ull> * info(pathfinder.pointToAllLabelSet<prio_queue_t>(randomSrc));
-			stabilizer.addValue(info->getTimeTaken());
-			delete info;
-			++replicationCount;
+			Dijkstra<ull, road_graph_t> pathfinder(graph);
+
+			while (!stabilizer.isStable())
+			{
+				vid_t randomSrc(randomGenerator.nextUniqueSizeT(1, graph->getVertexCount()));
+				PathInfo<ull> * info(pathfinder.pointToAllLabelSet<prio_queue_t>(randomSrc));
+				stabilizer.addValue(info->getTimeTaken());
+				delete info;
+				++replicationCount;
+			}
 		}
 
 		std::cout << "replications    : " << replicationCount				  << std::endl;
 		std::cout << "avg search time : " << stabilizer.getLastAvg() << " ms" << std::endl;
+		std::cout << "node allocations: " << AllocationCounter::getObjectCount()
+				  << " (" << AllocationCounter::getSystemAllocationCount() << " from system)" << std::endl;
 
 		ofstr << graph->getVertexCount() << ";" << stabilizer.getLastAvg() << std::endl;
 
@@ -193,22 +264,29 @@ void basicDijkstraExperiment(const std::string & pqname)
 
 	for (std::string & graphname : graphNames)
 	{
-		Graph<ull, DijkstraData<ull>> * graph = Roads::load<DijkstraData<ull>>(graphname);
-		Dijkstra<ull> pathfinder(graph);
+		road_graph_t * graph = Roads::loadCsr(graphname);
 		ValueStabilizer<100> stabilizer;
 		size_t replicationCount(0);
+		AllocationCounter::reset();
 
-		while (!stabilizer.isStable())
+		// fronty ij v pathfinder a aloktory ohlsia svoje uzly a pri zniku, preto vlastn blok
 		{
-			vid_t randomSrc(randomGenerator.nextUniqueSizeT(1, graph->getVertexCount()));
-			PathInfo<ull> * info(pathfinder.pointToAllBasic<prio_queue_t>(randomSrc));
-			stabilizer.addValue(info->getTimeTaken());
-			delete info;
-			++replicationCount;
+			Dijkstra<ull, road_graph_t> pathfinder(graph);
+
+			while (!stabilizer.isStable())
+			{
+				vid_t randomSrc(randomGenerator.nextUniqueSizeT(1, graph->getVertexCount()));
+				PathInfo<ull> * info(pathfinder.pointToAllBasic<prio_queue_t>(randomSrc));
+				stabilizer.addValue(info->getTimeTaken());
+				delete info;
+				++replicationCount;
+			}
 		}
 
 		std::cout << "replications    : " << replicationCount				  << std::endl;
 		std::cout << "avg search time : " << stabilizer.getLastAvg() << " ms" << std::endl;
+		std::cout << "node allocations: " << AllocationCounter::getObjectCount()
+				  << " (" << AllocationCounter::getSystemAllocationCount() << " from system)" << std::endl;
 
 		ofstr << graph->getVertexCount() << ";" << stabilizer.getLastAvg() << std::endl;
 
@@ -221,23 +299,80 @@ void basicDijkstraExperiment(const std::string & pqname)
 int main()
 {
 	testCorrectness<binary_heap>("BinaryHeap");
+	testCorrectness<stl_binary_heap>("StlBinaryHeap");
 	testCorrectness<binomial_heap>("BinomialHeap");
 	testCorrectness<fibonacci_heap>("FibonacciHeap");
-	testCorrectness<brodal_queue>("BrodalQueue");
-	testCorrectness<strict_fibonacci_heap>("StrictFibonacci");
+	testCorrectness<pooled_binomial_heap>("PooledBinomialHeap");
+	testCorrectness<lazy_binomial_heap>("LazyBinomialHeap");
+	testCorrectness<implicit_binomial_heap>("ImplicitBinomialHeap");
+	testCorrectness<pooled_fibonacci_heap>("PooledFibonacciHeap");
+	testCorrectness<indexed_fibonacci_heap>("IndexedFibonacciHeap");
+	// meld Brodalovho frontu pad a striktn Fibonacciho halda nezvldne dve intancie naraz, meld sa pri nich netestuje
+	testCorrectness<brodal_queue, 1000000, 144, false>("BrodalQueue");
+	testCorrectness<strict_fibonacci_heap, 1000000, 144, false>("StrictFibonacci");
 	testCorrectness<boost_fibonacci_heap>("BoostFibonacciHeap");
+	testCorrectness<boost_pairing_heap>("BoostPairingHeap");
+	testCorrectness<boost_binomial_heap>("BoostBinomialHeap");
+	testCorrectness<boost_skew_heap>("BoostSkewHeap");
+	testCorrectness<boost_d_ary_heap<4>>("BoostDaryHeap4");
+	testCorrectness<radix_heap>("RadixHeap");
+	testCorrectness<dary_heap<4>>("DaryHeap4");
+	testCorrectness<simd_list_queue, 20000>("SimdListQueue");
+	testCorrectness<hybrid_queue<128>>("HybridQueue128");
+	testCorrectness<pairing_heap>("PairingHeap");
+	testCorrectness<multipass_pairing_heap>("MultipassPairingHeap");
 
 	labelSetExperiment<binary_heap>("BinaryHeap");
+	labelSetExperiment<intrusive_binary_heap>("IntrusiveBinaryHeap");
+	labelSetExperiment<stl_binary_heap>("StlBinaryHeap");
+	labelSetExperiment<lazy_stl_binary_heap>("LazyStlBinaryHeap");
+	labelSetExperiment<binomial_heap>("BinomialHeap");
+	labelSetExperiment<lazy_binomial_heap>("LazyBinomialHeap");
+	labelSetExperiment<implicit_binomial_heap>("ImplicitBinomialHeap");
 	labelSetExperiment<fibonacci_heap>("FibonacciHeap");
+	labelSetExperiment<pooled_fibonacci_heap>("PooledFibonacciHeap");
+	labelSetExperiment<indexed_fibonacci_heap>("IndexedFibonacciHeap");
 	labelSetExperiment<brodal_queue>("BrodalQueue");
 	labelSetExperiment<strict_fibonacci_heap>("StrictFibonacciHeap");
 	labelSetExperiment<boost_fibonacci_heap>("BoostFibonacciHeap");
+	labelSetExperiment<boost_pairing_heap>("BoostPairingHeap");
+	labelSetExperiment<boost_binomial_heap>("BoostBinomialHeap");
+	labelSetExperiment<boost_skew_heap>("BoostSkewHeap");
+	labelSetExperiment<boost_d_ary_heap<2>>("BoostDaryHeap2");
+	labelSetExperiment<boost_d_ary_heap<4>>("BoostDaryHeap4");
+	labelSetExperiment<boost_d_ary_heap<8>>("BoostDaryHeap8");
+	labelSetExperiment<radix_heap>("RadixHeap");
+	labelSetExperiment<dary_heap<2>>("DaryHeap2");
+	labelSetExperiment<dary_heap<4>>("DaryHeap4");
+	labelSetExperiment<dary_heap<8>>("DaryHeap8");
+	labelSetExperiment<dary_heap<16>>("DaryHeap16");
+	labelSetExperiment<hybrid_queue<64>>("HybridQueue64");
+	labelSetExperiment<hybrid_queue<256>>("HybridQueue256");
+	labelSetExperiment<simd_list_queue>("SimdListQueue");
+	labelSetExperiment<pairing_heap>("PairingHeap");
+	labelSetExperiment<multipass_pairing_heap>("MultipassPairingHeap");
+	labelSetExperiment<bucket_queue>("BucketQueue");
+	labelSetExperiment<multilevel_bucket_queue<2, 1024>>("MultiLevelBucketQueue2x1024");
+	labelSetExperiment<multilevel_bucket_queue<3, 256>>("MultiLevelBucketQueue3x256");
+	labelSetExperiment<auto_queue>("AutoQueue");
 
 	basicDijkstraExperiment<binary_heap>("BinaryHeap");
+	basicDijkstraExperiment<stl_binary_heap>("StlBinaryHeap");
+	basicDijkstraExperiment<binomial_heap>("BinomialHeap");
+	basicDijkstraExperiment<lazy_binomial_heap>("LazyBinomialHeap");
+	basicDijkstraExperiment<implicit_binomial_heap>("ImplicitBinomialHeap");
 	basicDijkstraExperiment<fibonacci_heap>("FibonacciHeap");
+	basicDijkstraExperiment<pooled_fibonacci_heap>("PooledFibonacciHeap");
+	basicDijkstraExperiment<indexed_fibonacci_heap>("IndexedFibonacciHeap");
 	basicDijkstraExperiment<brodal_queue>("BrodalQueue");
 	basicDijkstraExperiment<strict_fibonacci_heap>("StrictFibonacciHeap");
 	basicDijkstraExperiment<boost_fibonacci_heap>("BoostFibonacciHeap");
+	basicDijkstraExperiment<boost_pairing_heap>("BoostPairingHeap");
+	basicDijkstraExperiment<boost_binomial_heap>("BoostBinomialHeap");
+	basicDijkstraExperiment<boost_skew_heap>("BoostSkewHeap");
+	basicDijkstraExperiment<boost_d_ary_heap<4>>("BoostDaryHeap4");
+	basicDijkstraExperiment<pairing_heap>("PairingHeap");
+	basicDijkstraExperiment<multipass_pairing_heap>("MultipassPairingHeap");
 
 	std::cout << std::endl << " <!#$@		PRESS ENY KEY		@$#!>" << std::endl;
 	getchar();